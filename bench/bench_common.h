@@ -0,0 +1,28 @@
+// ġũ  κ -  ð ߰ ڵ Ʋ ( ġũ Ͽ   )
+// : gcc -std=c99 -O2 -I.. -o <ġũ> <ġũ>.c ../student.c ../grade.c ../utils.c
+//       ../file_handler.c ../dictionary.c ../bitmap.c ../quantile.c ../thread_pool.c -lpthread -lm
+//  ڿ     Ӹ 
+#ifndef BENCH_COMMON_H
+#define BENCH_COMMON_H
+
+// clock_gettime  (ٸ   ǵǾ )
+#define _POSIX_C_SOURCE 200809L
+#include "student.h"
+#include <time.h>
+
+//  ð ()
+static inline double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// append_student_record  ڵ Ʋ - ̸//   й, GPA,  ȣڰ ä
+static inline void init_bench_record(StudentRecord *record) {
+    memset(record, 0, sizeof(*record));
+    strcpy(record->info.name, "л");
+    strcpy(record->info.major, "ǻͰ");
+    strcpy(record->info.reg_date, "2024-03-01");
+}
+
+#endif
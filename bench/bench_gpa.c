@@ -0,0 +1,176 @@
+// GPA ϰ  ġũ - recalculate_all_gpa  л (score_to_grade + calculate_gpa + notify_grades_changed) 
+// : bench_common.h 
+// : ./bench_gpa [л  (⺻ 1000000)]
+//    GPA(Ʈ ),  ,  ޱ   Ȯϰ ٸ 1 ȯ
+// 谪 Ȯ   л ù   NaN, 89.99999, 90.0, 0.0, 100.0 
+#include "bench_common.h"
+#include "grade.h"
+#include <math.h>
+
+#define BENCH_DEFAULT_COUNT 1000000
+#define BENCH_REPEAT 3
+#define BENCH_MAX_SUBJECTS 8
+
+// л 1 ~ 8,  0.0 ~ 100.0 (0.1 ),  1 ~ 4
+static StudentManager* build_manager(int count) {
+    char subjects[BENCH_MAX_SUBJECTS][16];
+    int subject_ids[BENCH_MAX_SUBJECTS];
+    for (int j = 0; j < BENCH_MAX_SUBJECTS; j++) {
+        snprintf(subjects[j], sizeof(subjects[j]), "%d", j + 1);
+        subject_ids[j] = intern_subject(subjects[j]);
+        if (subject_ids[j] == -1) return NULL;
+    }
+    
+    StudentManager *manager = create_manager(count);
+    if (!manager) return NULL;
+    
+    srand(1);
+    StudentRecord record;
+    Grade grades[BENCH_MAX_SUBJECTS];
+    init_bench_record(&record);
+    for (int i = 0; i < count; i++) {
+        int subject_count = 1 + rand() % BENCH_MAX_SUBJECTS;
+        for (int j = 0; j < subject_count; j++) {
+            grades[j].subject_id = subject_ids[j];
+            grades[j].score = (float)(rand() % 1001) / 10.0f;
+            grades[j].grade = 'F';
+            grades[j].credit = 1 + rand() % 4;
+        }
+        record.info.id = 20000000 + i;
+        record.grades = grades;
+        record.subject_count = subject_count;
+        if (!append_student_record(manager, &record)) {
+            destroy_manager(manager);
+            return NULL;
+        }
+    }
+    
+    // 谪: NaN /GPA  NaN  ı ƾ ϰ, 89.99999 B, 90.0 A 
+    static const float edge_scores[] = { NAN, 89.99999f, 90.0f, 0.0f, 100.0f };
+    for (int i = 0; i < (int)(sizeof(edge_scores) / sizeof(edge_scores[0])) && i < count; i++) {
+        get_record(manager, i)->grades[0].score = edge_scores[i];
+    }
+    return manager;
+}
+
+//  : л ް GPA ϰ ε  
+static void recalculate_per_record(StudentManager *manager) {
+    for (int i = 0; i < manager->slot_count; i++) {
+        StudentRecord *record = get_record(manager, i);
+        for (int j = 0; j < record->subject_count; j++) {
+            record->grades[j].grade = score_to_grade(record->grades[j].score);
+        }
+        record->gpa = calculate_gpa(record);
+        notify_grades_changed(record);
+    }
+}
+
+//     ٽ  Ȯ  ֵ  
+static void clear_results(StudentManager *manager) {
+    for (int i = 0; i < manager->slot_count; i++) {
+        StudentRecord *record = get_record(manager, i);
+        for (int j = 0; j < record->subject_count; j++) {
+            record->grades[j].grade = '?';
+        }
+        record->gpa = -1.0f;
+        record->total_credits = -1;
+    }
+}
+
+//     (GPA,  ,  )
+typedef struct {
+    float *gpa;
+    int *credits;
+    char *letters;
+} Expected;
+
+static void save_expected(StudentManager *manager, Expected *expected) {
+    for (int i = 0; i < manager->slot_count; i++) {
+        const StudentRecord *record = get_record(manager, i);
+        expected->gpa[i] = record->gpa;
+        expected->credits[i] = record->total_credits;
+        for (int j = 0; j < record->subject_count; j++) {
+            expected->letters[(size_t)i * BENCH_MAX_SUBJECTS + j] = record->grades[j].grade;
+        }
+    }
+}
+
+// ϰ    - ٸ ׸  ȯ
+static int count_mismatches(StudentManager *manager, const Expected *expected) {
+    int mismatches = 0;
+    for (int i = 0; i < manager->slot_count; i++) {
+        const StudentRecord *record = get_record(manager, i);
+        int same = memcmp(&expected->gpa[i], &record->gpa, sizeof(float)) == 0 &&
+                   expected->credits[i] == record->total_credits &&
+                   memcmp(&manager->hot.gpa[i], &record->gpa, sizeof(float)) == 0;
+        for (int j = 0; j < record->subject_count; j++) {
+            if (expected->letters[(size_t)i * BENCH_MAX_SUBJECTS + j] != record->grades[j].grade) same = 0;
+        }
+        if (!same) {
+            if (mismatches < 5) {
+                fprintf(stderr, "ġ: й %d (GPA %.9g / %.9g)\n",
+                        record->info.id, expected->gpa[i], record->gpa);
+            }
+            mismatches++;
+        }
+    }
+    return mismatches;
+}
+
+int main(int argc, char *argv[]) {
+    int count = argc > 1 ? atoi(argv[1]) : BENCH_DEFAULT_COUNT;
+    if (count <= 0) {
+        fprintf(stderr, ": л  1 ̻̾ մϴ.\n");
+        return 1;
+    }
+    
+    StudentManager *manager = build_manager(count);
+    Expected expected;
+    expected.gpa = (float*)malloc(sizeof(float) * count);
+    expected.credits = (int*)malloc(sizeof(int) * count);
+    expected.letters = (char*)malloc((size_t)count * BENCH_MAX_SUBJECTS);
+    if (!manager || !expected.gpa || !expected.credits || !expected.letters) {
+        fprintf(stderr, ": ޸𸮰 մϴ.\n");
+        return 1;
+    }
+    
+    double best_per_record = 0.0, best_batch = 0.0;
+    int mismatches = 0;
+    for (int rep = 0; rep < BENCH_REPEAT; rep++) {
+        clear_results(manager);
+        double start = now_seconds();
+        recalculate_per_record(manager);
+        double per_record = now_seconds() - start;
+        save_expected(manager, &expected);
+    
+        clear_results(manager);
+        start = now_seconds();
+        recalculate_all_gpa(manager);
+        double batch = now_seconds() - start;
+        mismatches += count_mismatches(manager, &expected);
+    
+        if (rep == 0 || per_record < best_per_record) best_per_record = per_record;
+        if (rep == 0 || batch < best_batch) best_batch = batch;
+    }
+    
+    printf("GPA  ġũ (%d, %dȸ  ּڰ)\n", count, BENCH_REPEAT);
+    printf("л : %8.1f ms\n", best_per_record * 1e3);
+    printf("ϰ :   %8.1f ms (%.1f)\n", best_batch * 1e3, best_per_record / best_batch);
+    
+    // 谪  Ȯ (89.99999 90 ̸̹Ƿ A ƴ)
+    int edges_ok = 1;
+    if (count >= 3) {
+        char below = get_record(manager, 1)->grades[0].grade;
+        char at = get_record(manager, 2)->grades[0].grade;
+        edges_ok = below == score_to_grade(89.99999f) && at == score_to_grade(90.0f) && below != at;
+        printf("谪 : NaN -> %c, 89.99999 -> %c, 90.0 -> %c\n",
+               get_record(manager, 0)->grades[0].grade, below, at);
+    }
+    printf(" : %s (ġ %d)\n", (mismatches == 0 && edges_ok) ? "ġ" : "ġ", mismatches);
+    
+    free(expected.gpa);
+    free(expected.credits);
+    free(expected.letters);
+    destroy_manager(manager);
+    return (mismatches == 0 && edges_ok) ? 0 : 1;
+}
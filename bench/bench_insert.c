@@ -0,0 +1,75 @@
+// л ߰ ġũ - ûũ ҿ ߰    л  ( ȯ O(1)) Ȯ
+// : bench_common.h 
+// : ./bench_insert [ִ л  (⺻ 10000000)]
+// 10^3 10  reserve_students add_student ߰  Ǵ  ð 
+// add_student  Ʈ (O(log n)) ε ĳ ̽ Ƿ  Ŀ ݾ þ
+#include "bench_common.h"
+
+#define BENCH_DEFAULT_COUNT 10000000
+#define BENCH_FIRST_DECADE 1000
+
+// 뷮   ÷  Ȯ (ûũ ߰ 븸 )
+static int bench_reserve(int total) {
+    StudentManager *manager = create_manager(1);
+    if (!manager) return 0;
+    
+    printf("\n[reserve_students]   뷮 Ȯ\n");
+    int begin = 0;
+    double start = now_seconds();
+    for (int decade = BENCH_FIRST_DECADE; begin < total; decade *= 10) {
+        int end = decade < total ? decade : total;
+        for (int i = begin; i < end; i++) {
+            if (!reserve_students(manager, i + 1)) {
+                destroy_manager(manager);
+                return 0;
+            }
+        }
+        double elapsed = now_seconds() - start;
+        printf("%10d ~ %10d: %8.1f ns/\n", begin, end, elapsed * 1e9 / (end - begin));
+        begin = end;
+        start = now_seconds();
+    }
+    destroy_manager(manager);
+    return 1;
+}
+
+// add_student  ߰ (й ε, ̸ ε,  Ʈ,  ÷  )
+// ̸   ξ ̸ ε  ׻  ڰ ǵ  ( 迭  ̵  )
+static int bench_add(int total) {
+    StudentManager *manager = create_manager(1);
+    if (!manager) return 0;
+    
+    printf("\n[add_student]   ߰\n");
+    int begin = 0;
+    double start = now_seconds();
+    for (int decade = BENCH_FIRST_DECADE; begin < total; decade *= 10) {
+        int end = decade < total ? decade : total;
+        for (int i = begin; i < end; i++) {
+            if (!add_student(manager, 20000000 + i, "л", "ǻͰ", "2024-03-01")) {
+                destroy_manager(manager);
+                return 0;
+            }
+        }
+        double elapsed = now_seconds() - start;
+        printf("%10d ~ %10d: %8.1f ns/\n", begin, end, elapsed * 1e9 / (end - begin));
+        begin = end;
+        start = now_seconds();
+    }
+    destroy_manager(manager);
+    return 1;
+}
+
+int main(int argc, char *argv[]) {
+    int total = argc > 1 ? atoi(argv[1]) : BENCH_DEFAULT_COUNT;
+    if (total <= 0) {
+        fprintf(stderr, ": л  1 ̻̾ մϴ.\n");
+        return 1;
+    }
+    
+    printf("л ߰ ġũ (ִ %d,  ߰  Ǵ )\n", total);
+    if (!bench_reserve(total) || !bench_add(total)) {
+        fprintf(stderr, ": ޸𸮰 մϴ.\n");
+        return 1;
+    }
+    return 0;
+}
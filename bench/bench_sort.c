@@ -0,0 +1,109 @@
+//  ġũ -  ( , (Ű, ) 8Ʈ ׸)  (ڵ 迭 ü qsort) 
+// : bench_common.h 
+// : ./bench_sort [л  ...] (⺻ 100000 1000000 10000000)
+//   compare_by_id/compare_by_gpa StudentRecord 迭 ° ϴ sort_by_id/sort_by_gpa 
+// 1000  ڿ 񱳿 ڵ 纻   1.7GB 
+#include "bench_common.h"
+#include "utils.h"
+
+// й  , GPA 0.000 ~ 4.499   л ߰ (  GPA )
+static StudentManager* build_manager(int count) {
+    StudentManager *manager = create_manager(count);
+    if (!manager) return NULL;
+    if (!reserve_students(manager, count)) {
+        destroy_manager(manager);
+        return NULL;
+    }
+    
+    srand(1);
+    StudentRecord record;
+    init_bench_record(&record);
+    for (int i = 0; i < count; i++) {
+        record.info.id = 20000000 + (int)(((long long)i * 7919) % count);
+        record.gpa = (float)(rand() % 4500) / 1000.0f;
+        if (!append_student_record(manager, &record)) {
+            destroy_manager(manager);
+            return NULL;
+        }
+    }
+    return manager;
+}
+
+// ڵ 迭   ٽ ä (    )
+static void fill_records(StudentManager *manager, StudentRecord *records) {
+    for (int i = 0; i < manager->slot_count; i++) {
+        records[i] = *get_record(manager, i);
+    }
+}
+
+//  ũ⿡    ð      -   1,   0 ȯ
+static int bench_size(int count) {
+    StudentManager *manager = build_manager(count);
+    StudentRecord *records = (StudentRecord*)malloc(sizeof(StudentRecord) * count);
+    if (!manager || !records) {
+        if (manager) destroy_manager(manager);
+        free(records);
+        return 0;
+    }
+    
+    int id_count, gpa_count;
+    double start = now_seconds();
+    const int *id_view = get_sorted_view(manager, SORT_BY_ID, &id_count);
+    double id_view_time = now_seconds() - start;
+    
+    start = now_seconds();
+    const int *gpa_view = get_sorted_view(manager, SORT_BY_GPA, &gpa_count);
+    double gpa_view_time = now_seconds() - start;
+    
+    if (!id_view || !gpa_view || id_count != count || gpa_count != count) {
+        destroy_manager(manager);
+        free(records);
+        return 0;
+    }
+    
+    // й ߺ Ƿ   ƾ ϰ, GPA   ٸ  ־  
+    int same = 1;
+    fill_records(manager, records);
+    start = now_seconds();
+    qsort(records, count, sizeof(StudentRecord), compare_by_id);
+    double id_qsort_time = now_seconds() - start;
+    for (int i = 0; i < count; i++) {
+        if (records[i].info.id != manager->hot.id[id_view[i]]) same = 0;
+    }
+    
+    fill_records(manager, records);
+    start = now_seconds();
+    qsort(records, count, sizeof(StudentRecord), compare_by_gpa);
+    double gpa_qsort_time = now_seconds() - start;
+    for (int i = 0; i < count; i++) {
+        if (records[i].gpa != manager->hot.gpa[gpa_view[i]]) same = 0;
+    }
+    
+    printf("%10d  й:  %8.3fs / qsort %8.3fs (%5.1f)  GPA:  %8.3fs / qsort %8.3fs (%5.1f)   %s\n",
+           count, id_view_time, id_qsort_time, id_qsort_time / id_view_time,
+           gpa_view_time, gpa_qsort_time, gpa_qsort_time / gpa_view_time,
+           same ? "ġ" : "ġ");
+    
+    destroy_manager(manager);
+    free(records);
+    return same;
+}
+
+int main(int argc, char *argv[]) {
+    static const int default_sizes[] = { 100000, 1000000, 10000000 };
+    int size_count = argc > 1 ? argc - 1 : (int)(sizeof(default_sizes) / sizeof(default_sizes[0]));
+    
+    printf(" ġũ (  ù  vs ڵ 迭 qsort)\n");
+    for (int i = 0; i < size_count; i++) {
+        int count = argc > 1 ? atoi(argv[i + 1]) : default_sizes[i];
+        if (count <= 0) {
+            fprintf(stderr, ": л  1 ̻̾ մϴ.\n");
+            return 1;
+        }
+        if (!bench_size(count)) {
+            fprintf(stderr, ": %d   ٸų ޸𸮰 մϴ.\n", count);
+            return 1;
+        }
+    }
+    return 0;
+}
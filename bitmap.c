@@ -0,0 +1,459 @@
+#include "bitmap.h"
+
+// 64Ʈ  1 Ʈ 
+static int popcount64(unsigned long long word) {
+#if defined(__GNUC__)
+    return __builtin_popcountll(word);
+#else
+    int count = 0;
+    while (word) {
+        word &= word - 1;
+        count++;
+    }
+    return count;
+#endif
+}
+
+// 64Ʈ    1 Ʈ ġ (word != 0)
+static int lowest_bit(unsigned long long word) {
+#if defined(__GNUC__)
+    return __builtin_ctzll(word);
+#else
+    int bit = 0;
+    while (!(word & 1)) {
+        word >>= 1;
+        bit++;
+    }
+    return bit;
+#endif
+}
+
+// Ʈ ʱȭ
+void init_bitmap(RoaringBitmap *bitmap) {
+    bitmap->containers = NULL;
+    bitmap->count = 0;
+    bitmap->capacity = 0;
+}
+
+// ̳ ޸ 
+static void free_container(BitmapContainer *container) {
+    free(container->array);
+    free(container->bits);
+}
+
+// Ʈ ޸  ( Ʈ ǵ)
+void destroy_bitmap(RoaringBitmap *bitmap) {
+    for (int i = 0; i < bitmap->count; i++) {
+        free_container(&bitmap->containers[i]);
+    }
+    free(bitmap->containers);
+    init_bitmap(bitmap);
+}
+
+//  迭 low ġ ã -  ġ,  -( ġ) - 1
+static int array_search(const unsigned short *array, int count, unsigned short low) {
+    int lo = 0, hi = count - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        if (array[mid] < low) lo = mid + 1;
+        else if (array[mid] > low) hi = mid - 1;
+        else return mid;
+    }
+    return -(lo + 1);
+}
+
+// key ̳ ġ ã -  ġ,  -( ġ) - 1
+static int find_container(const RoaringBitmap *bitmap, unsigned short key) {
+    int lo = 0, hi = bitmap->count - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        if (bitmap->containers[mid].key < key) lo = mid + 1;
+        else if (bitmap->containers[mid].key > key) hi = mid - 1;
+        else return mid;
+    }
+    return -(lo + 1);
+}
+
+// pos ġ  迭 ̳  -   NULL
+static BitmapContainer* insert_container(RoaringBitmap *bitmap, int pos, unsigned short key) {
+    if (bitmap->count == bitmap->capacity) {
+        int new_capacity = bitmap->capacity > 0 ? bitmap->capacity * 2 : 4;
+        BitmapContainer *containers = (BitmapContainer*)realloc(
+            bitmap->containers, sizeof(BitmapContainer) * new_capacity);
+        if (!containers) return NULL;
+        bitmap->containers = containers;
+        bitmap->capacity = new_capacity;
+    }
+
+    memmove(&bitmap->containers[pos + 1], &bitmap->containers[pos],
+            sizeof(BitmapContainer) * (bitmap->count - pos));
+    bitmap->count++;
+
+    BitmapContainer *container = &bitmap->containers[pos];
+    container->key = key;
+    container->cardinality = 0;
+    container->array = NULL;
+    container->capacity = 0;
+    container->bits = NULL;
+    return container;
+}
+
+// 迭 ̳ʸ Ʈ ȯ -   1,   0 ȯ
+static int array_to_bitset(BitmapContainer *container) {
+    unsigned long long *bits = (unsigned long long*)calloc(BITMAP_WORDS, sizeof(unsigned long long));
+    if (!bits) return 0;
+
+    for (int i = 0; i < container->cardinality; i++) {
+        bits[container->array[i] >> 6] |= 1ULL << (container->array[i] & 63);
+    }
+    free(container->array);
+    container->array = NULL;
+    container->capacity = 0;
+    container->bits = bits;
+    return 1;
+}
+
+// Ʈ ̳ʸ 迭 ȯ -   1,   0 ȯ (ϸ Ʈ )
+static int bitset_to_array(BitmapContainer *container) {
+    int capacity = container->cardinality > 0 ? container->cardinality : 1;
+    unsigned short *array = (unsigned short*)malloc(sizeof(unsigned short) * capacity);
+    if (!array) return 0;
+
+    int n = 0;
+    for (int w = 0; w < BITMAP_WORDS; w++) {
+        unsigned long long word = container->bits[w];
+        while (word) {
+            array[n++] = (unsigned short)((w << 6) + lowest_bit(word));
+            word &= word - 1;
+        }
+    }
+    free(container->bits);
+    container->bits = NULL;
+    container->array = array;
+    container->capacity = capacity;
+    return 1;
+}
+
+//  ߰ -   1, ޸   0 ȯ (̹  ״ 1)
+int bitmap_add(RoaringBitmap *bitmap, unsigned int value) {
+    unsigned short key = (unsigned short)(value >> 16);
+    unsigned short low = (unsigned short)(value & 0xFFFF);
+
+    int pos = find_container(bitmap, key);
+    BitmapContainer *container;
+    if (pos >= 0) {
+        container = &bitmap->containers[pos];
+    } else {
+        container = insert_container(bitmap, -pos - 1, key);
+        if (!container) {
+            fprintf(stderr, "޸ Ҵ : Ʈ\n");
+            return 0;
+        }
+    }
+
+    if (!container->bits) {
+        int at = array_search(container->array, container->cardinality, low);
+        if (at >= 0) return 1;
+
+        if (container->cardinality == BITMAP_ARRAY_MAX) {
+            if (!array_to_bitset(container)) {
+                fprintf(stderr, "޸ Ҵ : Ʈ\n");
+                return 0;
+            }
+        } else {
+            if (container->cardinality == container->capacity) {
+                int new_capacity = container->capacity > 0 ? container->capacity * 2 : 4;
+                if (new_capacity > BITMAP_ARRAY_MAX) new_capacity = BITMAP_ARRAY_MAX;
+                unsigned short *array = (unsigned short*)realloc(
+                    container->array, sizeof(unsigned short) * new_capacity);
+                if (!array) {
+                    fprintf(stderr, "޸ Ҵ : Ʈ\n");
+                    return 0;
+                }
+                container->array = array;
+                container->capacity = new_capacity;
+            }
+
+            at = -at - 1;
+            memmove(&container->array[at + 1], &container->array[at],
+                    sizeof(unsigned short) * (container->cardinality - at));
+            container->array[at] = low;
+            container->cardinality++;
+            return 1;
+        }
+    }
+
+    unsigned long long mask = 1ULL << (low & 63);
+    if (!(container->bits[low >> 6] & mask)) {
+        container->bits[low >> 6] |= mask;
+        container->cardinality++;
+    }
+    return 1;
+}
+
+//   ( )
+void bitmap_remove(RoaringBitmap *bitmap, unsigned int value) {
+    int pos = find_container(bitmap, (unsigned short)(value >> 16));
+    if (pos < 0) return;
+
+    BitmapContainer *container = &bitmap->containers[pos];
+    unsigned short low = (unsigned short)(value & 0xFFFF);
+
+    if (!container->bits) {
+        int at = array_search(container->array, container->cardinality, low);
+        if (at < 0) return;
+        memmove(&container->array[at], &container->array[at + 1],
+                sizeof(unsigned short) * (container->cardinality - at - 1));
+        container->cardinality--;
+    } else {
+        unsigned long long mask = 1ULL << (low & 63);
+        if (!(container->bits[low >> 6] & mask)) return;
+        container->bits[low >> 6] &= ~mask;
+        container->cardinality--;
+
+        //  ٸ 迭 ǵ ( Ʒ ȯϿ 迡 ݺ ȯ )
+        if (container->cardinality <= BITMAP_ARRAY_MAX / 2) {
+            bitset_to_array(container);
+        }
+    }
+
+    //  ̳ 
+    if (container->cardinality == 0) {
+        free_container(container);
+        memmove(&bitmap->containers[pos], &bitmap->containers[pos + 1],
+                sizeof(BitmapContainer) * (bitmap->count - pos - 1));
+        bitmap->count--;
+    }
+}
+
+//    -  1,  0
+int bitmap_contains(const RoaringBitmap *bitmap, unsigned int value) {
+    int pos = find_container(bitmap, (unsigned short)(value >> 16));
+    if (pos < 0) return 0;
+
+    const BitmapContainer *container = &bitmap->containers[pos];
+    unsigned short low = (unsigned short)(value & 0xFFFF);
+    if (container->bits) {
+        return (container->bits[low >> 6] >> (low & 63)) & 1;
+    }
+    return array_search(container->array, container->cardinality, low) >= 0;
+}
+
+// ü  
+int bitmap_cardinality(const RoaringBitmap *bitmap) {
+    int total = 0;
+    for (int i = 0; i < bitmap->count; i++) {
+        total += bitmap->containers[i].cardinality;
+    }
+    return total;
+}
+
+//  Ʈ  ڿ ̳ ߰ (  key  ) -   NULL
+static BitmapContainer* append_container(RoaringBitmap *result, unsigned short key) {
+    return insert_container(result, result->count, key);
+}
+
+// ̳ ϳ ״  -   1,   0 ȯ
+static int copy_container(const BitmapContainer *src, BitmapContainer *dst) {
+    dst->cardinality = src->cardinality;
+    if (src->bits) {
+        dst->bits = (unsigned long long*)malloc(sizeof(unsigned long long) * BITMAP_WORDS);
+        if (!dst->bits) return 0;
+        memcpy(dst->bits, src->bits, sizeof(unsigned long long) * BITMAP_WORDS);
+    } else {
+        dst->array = (unsigned short*)malloc(sizeof(unsigned short) * src->cardinality);
+        if (!dst->array) return 0;
+        memcpy(dst->array, src->array, sizeof(unsigned short) * src->cardinality);
+        dst->capacity = src->cardinality;
+    }
+    return 1;
+}
+
+//  ̳  dst  -   1,   0 ȯ
+static int and_containers(const BitmapContainer *a, const BitmapContainer *b, BitmapContainer *dst) {
+    if (a->bits && b->bits) {
+        // Ʈ³   AND
+        unsigned long long *bits = (unsigned long long*)malloc(sizeof(unsigned long long) * BITMAP_WORDS);
+        if (!bits) return 0;
+        int count = 0;
+        for (int w = 0; w < BITMAP_WORDS; w++) {
+            bits[w] = a->bits[w] & b->bits[w];
+            count += popcount64(bits[w]);
+        }
+        dst->bits = bits;
+        dst->cardinality = count;
+        if (count <= BITMAP_ARRAY_MAX) {
+            return bitset_to_array(dst);
+        }
+        return 1;
+    }
+
+    // 迭 ϳ     ũ  迭
+    const BitmapContainer *small = a->bits ? b : a;
+    const BitmapContainer *other = a->bits ? a : b;
+    int capacity = small->cardinality > 0 ? small->cardinality : 1;
+    unsigned short *array = (unsigned short*)malloc(sizeof(unsigned short) * capacity);
+    if (!array) return 0;
+
+    int n = 0;
+    if (other->bits) {
+        for (int i = 0; i < small->cardinality; i++) {
+            unsigned short low = small->array[i];
+            if ((other->bits[low >> 6] >> (low & 63)) & 1) {
+                array[n++] = low;
+            }
+        }
+    } else {
+        int i = 0, j = 0;
+        while (i < small->cardinality && j < other->cardinality) {
+            if (small->array[i] < other->array[j]) i++;
+            else if (small->array[i] > other->array[j]) j++;
+            else {
+                array[n++] = small->array[i];
+                i++;
+                j++;
+            }
+        }
+    }
+
+    dst->array = array;
+    dst->capacity = capacity;
+    dst->cardinality = n;
+    return 1;
+}
+
+//  ̳  dst  -   1,   0 ȯ
+static int or_containers(const BitmapContainer *a, const BitmapContainer *b, BitmapContainer *dst) {
+    if (!a->bits && !b->bits && a->cardinality + b->cardinality <= BITMAP_ARRAY_MAX) {
+        //  迭 
+        int capacity = a->cardinality + b->cardinality;
+        unsigned short *array = (unsigned short*)malloc(sizeof(unsigned short) * capacity);
+        if (!array) return 0;
+
+        int i = 0, j = 0, n = 0;
+        while (i < a->cardinality || j < b->cardinality) {
+            if (j == b->cardinality || (i < a->cardinality && a->array[i] < b->array[j])) {
+                array[n++] = a->array[i++];
+            } else if (i == a->cardinality || b->array[j] < a->array[i]) {
+                array[n++] = b->array[j++];
+            } else {
+                array[n++] = a->array[i];
+                i++;
+                j++;
+            }
+        }
+        dst->array = array;
+        dst->capacity = capacity;
+        dst->cardinality = n;
+        return 1;
+    }
+
+    //  ܿ Ʈ ħ
+    unsigned long long *bits = (unsigned long long*)calloc(BITMAP_WORDS, sizeof(unsigned long long));
+    if (!bits) return 0;
+    const BitmapContainer *sides[2] = {a, b};
+    for (int s = 0; s < 2; s++) {
+        const BitmapContainer *side = sides[s];
+        if (side->bits) {
+            for (int w = 0; w < BITMAP_WORDS; w++) bits[w] |= side->bits[w];
+        } else {
+            for (int i = 0; i < side->cardinality; i++) {
+                bits[side->array[i] >> 6] |= 1ULL << (side->array[i] & 63);
+            }
+        }
+    }
+
+    int count = 0;
+    for (int w = 0; w < BITMAP_WORDS; w++) {
+        count += popcount64(bits[w]);
+    }
+    dst->bits = bits;
+    dst->cardinality = count;
+    if (count <= BITMAP_ARRAY_MAX) {
+        return bitset_to_array(dst);
+    }
+    return 1;
+}
+
+//  (result = a AND b) -   1, ޸   0 ȯ
+int bitmap_and(const RoaringBitmap *a, const RoaringBitmap *b, RoaringBitmap *result) {
+    int i = 0, j = 0;
+    while (i < a->count && j < b->count) {
+        const BitmapContainer *ca = &a->containers[i];
+        const BitmapContainer *cb = &b->containers[j];
+        if (ca->key < cb->key) {
+            i++;
+        } else if (ca->key > cb->key) {
+            j++;
+        } else {
+            BitmapContainer *dst = append_container(result, ca->key);
+            if (!dst || !and_containers(ca, cb, dst)) {
+                fprintf(stderr, "޸ Ҵ : Ʈ\n");
+                return 0;
+            }
+            if (dst->cardinality == 0) {
+                free_container(dst);
+                result->count--;
+            }
+            i++;
+            j++;
+        }
+    }
+    return 1;
+}
+
+//  (result = a OR b) -   1, ޸   0 ȯ
+int bitmap_or(const RoaringBitmap *a, const RoaringBitmap *b, RoaringBitmap *result) {
+    int i = 0, j = 0;
+    while (i < a->count || j < b->count) {
+        const BitmapContainer *ca = (i < a->count) ? &a->containers[i] : NULL;
+        const BitmapContainer *cb = (j < b->count) ? &b->containers[j] : NULL;
+        BitmapContainer *dst;
+        int ok;
+
+        if (cb == NULL || (ca != NULL && ca->key < cb->key)) {
+            dst = append_container(result, ca->key);
+            ok = dst && copy_container(ca, dst);
+            i++;
+        } else if (ca == NULL || cb->key < ca->key) {
+            dst = append_container(result, cb->key);
+            ok = dst && copy_container(cb, dst);
+            j++;
+        } else {
+            dst = append_container(result, ca->key);
+            ok = dst && or_containers(ca, cb, dst);
+            i++;
+            j++;
+        }
+
+        if (!ok) {
+            fprintf(stderr, "޸ Ҵ : Ʈ\n");
+            return 0;
+        }
+    }
+    return 1;
+}
+
+//    values  (bitmap_cardinality ũ ̻) -   ȯ
+int bitmap_to_array(const RoaringBitmap *bitmap, unsigned int *values) {
+    int n = 0;
+    for (int i = 0; i < bitmap->count; i++) {
+        const BitmapContainer *container = &bitmap->containers[i];
+        unsigned int high = (unsigned int)container->key << 16;
+
+        if (container->bits) {
+            for (int w = 0; w < BITMAP_WORDS; w++) {
+                unsigned long long word = container->bits[w];
+                while (word) {
+                    values[n++] = high | (unsigned int)((w << 6) + lowest_bit(word));
+                    word &= word - 1;
+                }
+            }
+        } else {
+            for (int j = 0; j < container->cardinality; j++) {
+                values[n++] = high | container->array[j];
+            }
+        }
+    }
+    return n;
+}
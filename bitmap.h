@@ -0,0 +1,44 @@
+#ifndef BITMAP_H
+#define BITMAP_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ̳  ȯ  -  ̺  Ʈ, ̸  迭
+#define BITMAP_ARRAY_MAX 4096
+#define BITMAP_WORDS 1024        // Ʈ ̳ 64Ʈ   (2^16 Ʈ)
+
+// Ʈ ̳ -  16Ʈ    16Ʈ 
+typedef struct {
+    unsigned short key;          //   16Ʈ
+    int cardinality;             // ̳ʿ   
+    unsigned short *array;       // 迭 ̳ (ĵ  16Ʈ), Ʈ̸ NULL
+    int capacity;                // array 迭 ũ
+    unsigned long long *bits;    // Ʈ ̳ (BITMAP_WORDS ), 迭̸ NULL
+} BitmapContainer;
+
+//  Ʈ (roaring ) - 0 ̻    16Ʈ ̳ʷ  
+// 幮   迭,   Ʈ Ͽ / ̳  ó
+typedef struct {
+    BitmapContainer *containers; // key  ̳ 迭
+    int count;                   // ̳ 
+    int capacity;                // containers 迭 ũ
+} RoaringBitmap;
+
+// Ʈ  Լ
+void init_bitmap(RoaringBitmap *bitmap);
+void destroy_bitmap(RoaringBitmap *bitmap);
+
+//  ߰//ȸ Լ
+int bitmap_add(RoaringBitmap *bitmap, unsigned int value);
+void bitmap_remove(RoaringBitmap *bitmap, unsigned int value);
+int bitmap_contains(const RoaringBitmap *bitmap, unsigned int value);
+int bitmap_cardinality(const RoaringBitmap *bitmap);
+
+//   Լ ( Ʈ init_bitmap ʱȭ  Ʈ̾ )
+int bitmap_and(const RoaringBitmap *a, const RoaringBitmap *b, RoaringBitmap *result);
+int bitmap_or(const RoaringBitmap *a, const RoaringBitmap *b, RoaringBitmap *result);
+int bitmap_to_array(const RoaringBitmap *bitmap, unsigned int *values);
+
+#endif // BITMAP_H
@@ -0,0 +1,110 @@
+#include "dictionary.h"
+
+// ڿ ؽ Լ (FNV-1a, EUC-KR  Ʈ  ó)
+static unsigned int hash_string(const char *str) {
+    unsigned int h = 2166136261u;
+    while (*str) {
+        h ^= (unsigned char)*str++;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+// ڿ  ؽ ̺ ġ ã -    ĭ ġ ȯ
+static int probe_string(const StringDict *dict, const char *str) {
+    unsigned int mask = (unsigned int)dict->table_size - 1;
+    unsigned int pos = hash_string(str) & mask;
+    
+    while (dict->table[pos] != -1 && strcmp(dict->names[dict->table[pos]], str) != 0) {
+        pos = (pos + 1) & mask;
+    }
+    return (int)pos;
+}
+
+// ؽ ̺   ø ü  -   1,   0 ȯ
+static int grow_table(StringDict *dict) {
+    int new_size = dict->table_size > 0 ? dict->table_size * 2 : 64;
+    int *table = (int*)malloc(sizeof(int) * new_size);
+    if (!table) {
+        fprintf(stderr, "޸ Ҵ : ڿ \n");
+        return 0;
+    }
+    
+    free(dict->table);
+    dict->table = table;
+    dict->table_size = new_size;
+    
+    for (int i = 0; i < new_size; i++) {
+        dict->table[i] = -1;
+    }
+    for (int id = 0; id < dict->count; id++) {
+        dict->table[probe_string(dict, dict->names[id])] = id;
+    }
+    return 1;
+}
+
+//   ʱȭ
+void init_dictionary(StringDict *dict) {
+    dict->names = NULL;
+    dict->count = 0;
+    dict->capacity = 0;
+    dict->table = NULL;
+    dict->table_size = 0;
+}
+
+//  ޸ 
+void destroy_dictionary(StringDict *dict) {
+    for (int i = 0; i < dict->count; i++) {
+        free(dict->names[i]);
+    }
+    free(dict->names);
+    free(dict->table);
+    init_dictionary(dict);
+}
+
+// ڿ ID ȸ -  -1 ȯ
+int find_string(const StringDict *dict, const char *str) {
+    if (dict->table_size == 0) return -1;
+    return dict->table[probe_string(dict, str)];
+}
+
+// ڿ  - ̹   ID,   ID ȯ (޸   -1)
+int intern_string(StringDict *dict, const char *str) {
+    int id = find_string(dict, str);
+    if (id != -1) return id;
+    
+    //  50%  
+    if ((dict->count + 1) * 2 > dict->table_size && !grow_table(dict)) {
+        return -1;
+    }
+    
+    if (dict->count == dict->capacity) {
+        int new_capacity = dict->capacity > 0 ? dict->capacity * 2 : 16;
+        char **names = (char**)realloc(dict->names, sizeof(char*) * new_capacity);
+        if (!names) {
+            fprintf(stderr, "޸ Ҵ : ڿ \n");
+            return -1;
+        }
+        dict->names = names;
+        dict->capacity = new_capacity;
+    }
+    
+    size_t len = strlen(str);
+    char *copy = (char*)malloc(len + 1);
+    if (!copy) {
+        fprintf(stderr, "޸ Ҵ : ڿ \n");
+        return -1;
+    }
+    memcpy(copy, str, len + 1);
+    
+    id = dict->count++;
+    dict->names[id] = copy;
+    dict->table[probe_string(dict, str)] = id;
+    return id;
+}
+
+// ID شϴ ڿ ȯ - ߸ ID  ڿ
+const char* get_string(const StringDict *dict, int id) {
+    if (id < 0 || id >= dict->count) return "";
+    return dict->names[id];
+}
@@ -0,0 +1,27 @@
+#ifndef DICTIONARY_H
+#define DICTIONARY_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ڿ  ü -  ڿ   ϰ   ID 
+// (,   ݺǴ ڿ  񱳷 óϱ  )
+typedef struct {
+    char **names;                // ID -> ڿ 迭
+    int count;                   // ϵ ڿ  (ID 0 ~ count-1)
+    int capacity;                // names 迭 ũ
+    int *table;                  // ڿ ؽ ̺ ( ּҹ,  ID,  ĭ -1)
+    int table_size;              // ؽ ̺ ũ (2 ŵ)
+} StringDict;
+
+//   Լ
+void init_dictionary(StringDict *dict);
+void destroy_dictionary(StringDict *dict);
+
+// ڿ /ȸ Լ
+int intern_string(StringDict *dict, const char *str);
+int find_string(const StringDict *dict, const char *str);
+const char* get_string(const StringDict *dict, int id);
+
+#endif // DICTIONARY_H
@@ -1,4 +1,17 @@
 #include "file_handler.h"
+#include "thread_pool.h"
+#include <stdint.h>
+#include <sys/stat.h>
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
 
 // ڿ յ  
 char* trim_whitespace(char *str) {
@@ -51,85 +64,780 @@ int is_valid_csv_format(const char *filename) {
     return valid;
 }
 
-//  ڿ Ľ (: "::;::;...")
-int parse_grades_string(const char *grades_str, StudentRecord *record) {
-    if (!grades_str || strlen(grades_str) == 0) {
-        record->subject_count = 0;
-        record->gpa = 0.0;
+// sscanf ǳʶٴ   Ȯ
+static int is_scan_space(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+}
+
+// trim_whitespace    [*begin, *end) յ  
+static void trim_span(const char **begin, const char **end) {
+    const char *b = *begin;
+    const char *e = *end;
+    while (b < e && (*b == ' ' || *b == '\t' || *b == '\n' || *b == '\r')) b++;
+    while (e > b && (e[-1] == ' ' || e[-1] == '\t' || e[-1] == '\n' || e[-1] == '\r')) e--;
+    *begin = b;
+    *end = e;
+}
+
+//  ڿ size Ʈ ۿ  (ġ size - 1 Ʈ)
+static void copy_span(char *dest, size_t size, const char *begin, const char *end) {
+    size_t length = (size_t)(end - begin);
+    if (length > size - 1) length = size - 1;
+    memcpy(dest, begin, length);
+    dest[length] = '\0';
+}
+
+// ǥ ʵ  "" " ٲٸ size Ʈ ۿ  (escaped 0̸ copy_span )
+static void copy_unescaped(char *dest, size_t size, const char *begin, const char *end, int escaped) {
+    if (!escaped) {
+        copy_span(dest, size, begin, end);
+        return;
+    }
+    
+    size_t length = 0;
+    for (const char *p = begin; p < end && length < size - 1; p++) {
+        dest[length++] = *p;
+        if (*p == '"' && p + 1 < end && p[1] == '"') p++;
+    }
+    dest[length] = '\0';
+}
+
+//  Ľ (%d    ȣ ) - ڰ  0 ȯ,   *pos  ڷ ̵
+static int parse_int_span(const char **pos, const char *end, int *value) {
+    const char *p = *pos;
+    while (p < end && is_scan_space(*p)) p++;
+    
+    int negative = 0;
+    if (p < end && (*p == '+' || *p == '-')) {
+        negative = (*p == '-');
+        p++;
+    }
+    
+    const char *digits = p;
+    long long number = 0;
+    while (p < end && *p >= '0' && *p <= '9') {
+        if (number < 10000000000LL) number = number * 10 + (*p - '0');
+        p++;
+    }
+    if (p == digits) return 0;
+    
+    *value = (int)(negative ? -number : number);
+    *pos = p;
+    return 1;
+}
+
+// Ǽ Ľ (%f  ) - ڰ  0 ȯ,   *pos  ڷ ̵
+// ȿ  7ڸ, Ҽ 10ڸ  Ϲ ǥ float    Ȯ ݿøǾ
+// strtof   ,   ǥ(, 16, inf/nan ) strtof ó
+static int parse_float_span(const char **pos, const char *end, float *value) {
+    static const float powers_of_ten[] = {
+        1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+    };
+    const char *p = *pos;
+    while (p < end && is_scan_space(*p)) p++;
+    const char *start = p;
+    
+    int negative = 0;
+    if (p < end && (*p == '+' || *p == '-')) {
+        negative = (*p == '-');
+        p++;
+    }
+    
+    unsigned long mantissa = 0;
+    int digits = 0;
+    int fraction = 0;
+    while (p < end && *p >= '0' && *p <= '9') {
+        if (mantissa <= (1UL << 24)) mantissa = mantissa * 10 + (unsigned long)(*p - '0');
+        digits++;
+        p++;
+    }
+    if (p < end && *p == '.') {
+        p++;
+        while (p < end && *p >= '0' && *p <= '9') {
+            if (mantissa <= (1UL << 24)) mantissa = mantissa * 10 + (unsigned long)(*p - '0');
+            digits++;
+            fraction++;
+            p++;
+        }
+    }
+    
+    int simple = digits > 0 && mantissa <= (1UL << 24) && fraction <= 10 &&
+                 !(p < end && (*p == 'e' || *p == 'E' || *p == 'x' || *p == 'X'));
+    if (simple) {
+        float number = (float)mantissa / powers_of_ten[fraction];
+        *value = negative ? -number : number;
+        *pos = p;
         return 1;
     }
     
-    char *grades_copy = strdup(grades_str);
-    char *grade_token = strtok(grades_copy, ";");
+    // Ϲ ǥⰡ ƴϸ ª 纻 strtof Ľ ( Ҵ )
+    char buffer[64];
+    char *stop;
+    copy_span(buffer, sizeof(buffer), start, end);
+    float number = strtof(buffer, &stop);
+    if (stop == buffer) return 0;
+    
+    *value = number;
+    *pos = start + (stop - buffer);
+    return 1;
+}
+
+// "::"  ׸ Ľ -   1, ƴϸ 0 ȯ
+// subjects NULL̸    , ƴϸ subjects  ( ε)
+static int parse_grade_token(const char *begin, const char *end, int escaped,
+                             StringDict *subjects, Grade *grade) {
+    //  ':'    ̻
+    const char *colon = (const char*)memchr(begin, ':', (size_t)(end - begin));
+    if (!colon || colon == begin) return 0;
+    
+    const char *p = colon + 1;
+    float score;
+    int credit;
+    if (!parse_float_span(&p, end, &score) || p >= end || *p != ':') return 0;
+    p++;
+    if (!parse_int_span(&p, end, &credit)) return 0;
+    
+    //   ϰ  ID 
+    char subject[MAX_NAME_LEN];
+    copy_unescaped(subject, sizeof(subject), begin, colon, escaped);
+    grade->subject_id = subjects ? intern_string(subjects, subject) : intern_subject(subject);
+    if (grade->subject_id == -1) return 0;
+    grade->score = score;
+    grade->credit = credit;
+    grade->grade = 0;
+    return 1;
+}
+
+//   Ľ (: "::;::;...")
+// escaped 1̸ ǥ ʵ  ̹Ƿ  "" " ٲ
+// compute_gpa 0̸ ް GPA  ΰ ε  recalculate_all_gpa ϰ 
+//  迭 ڵ忡 ̹ ִ  ϰ ڶ  Ȯ
+static void parse_grade_span(const char *begin, const char *end, int escaped, StringDict *subjects,
+                             StudentRecord *record, int compute_gpa) {
     int count = 0;
     
-    while (grade_token && count < MAX_SUBJECTS) {
-        char subject[MAX_NAME_LEN];
-        float score;
-        int credit;
+    //     -  ׸ ǳʶ
+    const char *p = begin;
+    while (p < end) {
+        const char *separator = (const char*)memchr(p, ';', (size_t)(end - p));
+        const char *token_end = separator ? separator : end;
         
-        // "::"  Ľ
-        if (sscanf(grade_token, "%[^:]:%f:%d", subject, &score, &credit) == 3) {
-            strncpy(record->grades[count].subject, subject, MAX_NAME_LEN - 1);
-            record->grades[count].subject[MAX_NAME_LEN - 1] = '\0';
-            record->grades[count].score = score;
-            record->grades[count].credit = credit;
-            record->grades[count].grade = score_to_grade(score);
-            count++;
+        Grade grade;
+        if (token_end > p && parse_grade_token(p, token_end, escaped, subjects, &grade)) {
+            if (!reserve_grades(record, count + 1)) break;
+            record->grades[count++] = grade;
         }
-        
-        grade_token = strtok(NULL, ";");
+        p = separator ? separator + 1 : end;
     }
     
-    free(grades_copy);
     record->subject_count = count;
-    record->gpa = calculate_gpa(record);
+    if (compute_gpa) {
+        for (int i = 0; i < count; i++) {
+            record->grades[i].grade = score_to_grade(record->grades[i].score);
+        }
+        record->gpa = calculate_gpa(record);
+    }
+}
+
+//  ڿ Ľ  ް GPA 
+int parse_grades_string(const char *grades_str, StudentRecord *record) {
+    record->subject_count = 0;
+    record->weighted_sum = 0.0;
+    record->total_credits = 0;
+    record->gpa = 0.0;
+    if (grades_str) {
+        parse_grade_span(grades_str, grades_str + strlen(grades_str), 0, NULL, record, 1);
+    }
+    return 1;
+}
+
+// Ľ̿ ӽ ڵ ʱȭ (  ڵ,  迭 )
+static void init_parse_record(StudentRecord *record) {
+    memset(record, 0, sizeof(StudentRecord));
+    record->grades = NULL;
+    record->owner = NULL;
+}
+
+// CSV   - ϸ ޸ ϰ,     ü    
+typedef struct {
+    const char *data;            //  
+    size_t size;                 // Ʈ 
+    int mapped;                  // 1̸ mmap , 0̸ malloc 
+} CsvFile;
+
+// CSV   -   1,   0 ȯ
+static int open_csv_file(const char *filename, CsvFile *file) {
+    file->data = NULL;
+    file->size = 0;
+    file->mapped = 0;
+    
+#if !defined(_WIN32)
+    int fd = open(filename, O_RDONLY);
+    if (fd == -1) return 0;
+    
+    struct stat info;
+    if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0) {
+        void *data = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED) {
+#if defined(POSIX_MADV_SEQUENTIAL)
+            // տ   Ƿ Ŀο  б⸦ ˸
+            posix_madvise(data, (size_t)info.st_size, POSIX_MADV_SEQUENTIAL);
+#endif
+            file->data = (const char*)data;
+            file->size = (size_t)info.st_size;
+            file->mapped = 1;
+            close(fd);
+            return 1;
+        }
+    }
+    close(fd);
+#endif
     
+    //  , ,   ȯ ü 
+    FILE *stream = fopen(filename, "rb");
+    if (!stream) return 0;
+    
+    size_t capacity = 65536;
+    size_t length = 0;
+    char *buffer = (char*)malloc(capacity);
+    while (buffer) {
+        size_t bytes = fread(buffer + length, 1, capacity - length, stream);
+        length += bytes;
+        if (bytes == 0 || length < capacity) break;
+        
+        char *grown = (char*)realloc(buffer, capacity * 2);
+        if (!grown) {
+            free(buffer);
+            buffer = NULL;
+            break;
+        }
+        buffer = grown;
+        capacity *= 2;
+    }
+    fclose(stream);
+    
+    if (!buffer) {
+        fprintf(stderr, "޸ Ҵ :  б\n");
+        return 0;
+    }
+    file->data = buffer;
+    file->size = length;
+    return 1;
+}
+
+// CSV  ݱ
+static void close_csv_file(CsvFile *file) {
+#if !defined(_WIN32)
+    if (file->mapped) {
+        munmap((void*)file->data, file->size);
+        file->data = NULL;
+        return;
+    }
+#endif
+    free((void*)file->data);
+    file->data = NULL;
+}
+
+// CSV ʵ - ǥ  ʵ ٱ ǥ  
+typedef struct {
+    const char *begin;
+    const char *end;
+    int escaped;                 // 1̸ 뿡 "" ̽ ־   " ٲ 
+} CsvField;
+
+// ʵ  size Ʈ ۿ 
+static void copy_field(char *dest, size_t size, const CsvField *field) {
+    copy_unescaped(dest, size, field->begin, field->end, field->escaped);
+}
+
+// CSV ڵ б  (RFC 4180)
+//  CSV_BLOCK Ʈ   SIMD Ͽ ',', '"', '\n' ġ Ʈũ  
+// ũ Ʈ 󰡸 ʵ ڵ 踦  ( ڰ ƴ Ʈ ٽ  )
+typedef struct {
+    const char *pos;             //  ڵ 
+    const char *end;             // Է 
+    const char *block;           //   
+    const char *next_block;      //  з  
+    unsigned long long mask;     //  Ͽ  ó    ġ
+    int line_number;             //   ڵ   ȣ (1,  )
+    int lines_read;              // ݱ  ٹٲ  (ǥ  ٹٲ )
+    CsvField fields[CSV_MAX_FIELDS];
+    int field_count;             // ڵ ʵ  (CSV_MAX_FIELDS Ѵ ʵ  )
+    StringDict *subjects;        //    (NULL̸   )
+} CsvReader;
+
+//  64Ʈ ',', '"', '\n' ġ Ʈũ ȯ (block CSV_BLOCK Ʈ   ־ )
+static unsigned long long classify_block(const char *block) {
+    unsigned long long mask = 0;
+#if defined(__AVX2__)
+    const __m256i comma = _mm256_set1_epi8(',');
+    const __m256i quote = _mm256_set1_epi8('"');
+    const __m256i newline = _mm256_set1_epi8('\n');
+    for (int i = 0; i < CSV_BLOCK; i += 32) {
+        __m256i bytes = _mm256_loadu_si256((const __m256i*)(block + i));
+        __m256i hits = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(bytes, comma),
+                                                        _mm256_cmpeq_epi8(bytes, quote)),
+                                       _mm256_cmpeq_epi8(bytes, newline));
+        mask |= (unsigned long long)(unsigned int)_mm256_movemask_epi8(hits) << i;
+    }
+#elif defined(__SSE2__) || defined(_M_X64)
+    const __m128i comma = _mm_set1_epi8(',');
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i newline = _mm_set1_epi8('\n');
+    for (int i = 0; i < CSV_BLOCK; i += 16) {
+        __m128i bytes = _mm_loadu_si128((const __m128i*)(block + i));
+        __m128i hits = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(bytes, comma),
+                                                 _mm_cmpeq_epi8(bytes, quote)),
+                                    _mm_cmpeq_epi8(bytes, newline));
+        mask |= (unsigned long long)(unsigned int)_mm_movemask_epi8(hits) << i;
+    }
+#else
+    for (int i = 0; i < CSV_BLOCK; i++) {
+        char c = block[i];
+        if (c == ',' || c == '"' || c == '\n') mask |= 1ULL << i;
+    }
+#endif
+    return mask;
+}
+
+//   1 Ʈ ġ (mask 0 ƴϾ )
+static int lowest_bit(unsigned long long mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(mask);
+#else
+    int bit = 0;
+    while (!(mask & 1ULL)) {
+        mask >>= 1;
+        bit++;
+    }
+    return bit;
+#endif
+}
+
+// [data, data + size)  д CSV б  ʱȭ
+static void init_csv_reader(CsvReader *reader, const char *data, size_t size) {
+    reader->pos = data;
+    reader->end = data + size;
+    reader->block = data;
+    reader->next_block = data;
+    reader->mask = 0;
+    reader->line_number = 0;
+    reader->lines_read = 0;
+    reader->field_count = 0;
+    reader->subjects = NULL;
+}
+
+//    ġ - Է ̸ NULL ȯ
+static const char* next_structural(CsvReader *reader) {
+    while (reader->mask == 0) {
+        if (reader->next_block >= reader->end) return NULL;
+        
+        size_t remaining = (size_t)(reader->end - reader->next_block);
+        reader->block = reader->next_block;
+        if (remaining >= CSV_BLOCK) {
+            reader->mask = classify_block(reader->block);
+            reader->next_block += CSV_BLOCK;
+        } else {
+            //   0 ä 纻 з (Է  ʸӸ  )
+            char padded[CSV_BLOCK] = { 0 };
+            memcpy(padded, reader->block, remaining);
+            reader->mask = classify_block(padded);
+            reader->next_block = reader->end;
+        }
+    }
+    
+    int bit = lowest_bit(reader->mask);
+    reader->mask &= reader->mask - 1;
+    return reader->block + bit;
+}
+
+//  (' ', '\t') Ȯ
+static int is_blank_span(const char *begin, const char *end) {
+    for (const char *p = begin; p < end; p++) {
+        if (*p != ' ' && *p != '\t') return 0;
+    }
     return 1;
 }
 
-// CSV   ĽϿ StudentRecord 
+// ڵ忡 ʵ ߰ - ǥ ʵ ǥ   ״, ƴϸ յ  
+static void add_csv_field(CsvReader *reader, const char *begin, const char *end,
+                          const char *quote_begin, const char *quote_end, int escaped) {
+    if (reader->field_count < CSV_MAX_FIELDS) {
+        CsvField *field = &reader->fields[reader->field_count];
+        if (quote_begin) {
+            field->begin = quote_begin;
+            field->end = quote_end;
+            field->escaped = escaped;
+        } else {
+            trim_span(&begin, &end);
+            field->begin = begin;
+            field->end = end;
+            field->escaped = 0;
+        }
+    }
+    reader->field_count++;
+}
+
+//  ڵ带 ʵ  -  ̻ ڵ尡  0 ȯ
+// ʵ ( ) '"' ǥ ʵ带 ,   ',' ٹٲ , "" " 
+// ǥ  ʵ ߰ '"' Ϲ ̸, ݴ ǥ    ڴ 
+static int next_csv_record(CsvReader *reader) {
+    if (reader->pos >= reader->end) return 0;
+    
+    reader->line_number = reader->lines_read + 1;
+    reader->field_count = 0;
+    
+    const char *field_start = reader->pos;
+    const char *quote_begin = NULL;  // ǥ ʵ  
+    const char *quote_end = NULL;    // ݴ ǥ ġ
+    int in_quotes = 0;
+    int escaped = 0;
+    
+    for (;;) {
+        const char *p = next_structural(reader);
+        
+        if (in_quotes) {
+            if (!p) {
+                //   ǥ Է   
+                quote_end = reader->end;
+            } else if (*p == '"') {
+                if (p + 1 < reader->end && p[1] == '"') {
+                    next_structural(reader);   // ¦ Ǵ ǥ ٷ   
+                    escaped = 1;
+                } else {
+                    quote_end = p;
+                    in_quotes = 0;
+                }
+                continue;
+            } else {
+                if (*p == '\n') reader->lines_read++;
+                continue;
+            }
+        }
+        
+        if (p && *p == '"') {
+            if (!quote_begin && is_blank_span(field_start, p)) {
+                quote_begin = p + 1;
+                in_quotes = 1;
+            }
+            continue;
+        }
+        
+        // ',' Ǵ ڵ  - ʵ ϼ
+        const char *stop = p ? p : reader->end;
+        add_csv_field(reader, field_start, stop, quote_begin, quote_end, escaped);
+        quote_begin = NULL;
+        quote_end = NULL;
+        escaped = 0;
+        
+        if (p && *p == ',') {
+            field_start = p + 1;
+            continue;
+        }
+        
+        if (p) reader->lines_read++;
+        reader->pos = p ? p + 1 : reader->end;
+        return 1;
+    }
+}
+
+//   Ȯ (  )
+static int is_blank_record(const CsvReader *reader) {
+    return reader->field_count == 1 && reader->fields[0].begin == reader->fields[0].end;
+}
+
+// ڵ ʵ StudentRecord ä (compute_gpa parse_grade_span )
+// ʵ  ID, Name, Major, Reg_Date, Grades - ּ 4 ʵ尡  1 ȯ
+// Է  ʰ ʵ  ٷ Ľϸ,  迭 ڵ忡 ִ  
+static int parse_student_fields(const CsvReader *reader, StudentRecord *record, int compute_gpa) {
+    record->subject_count = 0;
+    record->weighted_sum = 0.0;
+    record->total_credits = 0;
+    record->gpa = 0.0;
+    
+    if (reader->field_count < 4) return 0;
+    
+    // ID (atoi  ڰ  0)
+    const CsvField *field = &reader->fields[0];
+    const char *digits = field->begin;
+    if (!parse_int_span(&digits, field->end, &record->info.id)) record->info.id = 0;
+    
+    copy_field(record->info.name, MAX_NAME_LEN, &reader->fields[1]);
+    copy_field(record->info.major, MAX_MAJOR_LEN, &reader->fields[2]);
+    copy_field(record->info.reg_date, sizeof(record->info.reg_date), &reader->fields[3]);
+    
+    if (reader->field_count > 4) {
+        field = &reader->fields[4];
+        parse_grade_span(field->begin, field->end, field->escaped, reader->subjects,
+                         record, compute_gpa);
+    }
+    return 1;
+}
+
+// CSV   ĽϿ StudentRecord  (ް GPA )
+//  迭 malloc ȮǹǷ   release_grades ؾ 
 int parse_student_line(const char *line, StudentRecord *record) {
-    char line_copy[2048];
-    strncpy(line_copy, line, sizeof(line_copy) - 1);
-    line_copy[sizeof(line_copy) - 1] = '\0';
+    CsvReader reader;
+    init_parse_record(record);
+    init_csv_reader(&reader, line, strlen(line));
+    if (!next_csv_record(&reader)) return 0;
+    return parse_student_fields(&reader, record, 1);
+}
+
+//  ε忡 ûũ Ľ 
+typedef struct {
+    Student info;                // л ⺻ 
+    int line_number;             // ûũ    ȣ (1)
+    int grade_begin;             // ûũ  迭  ġ
+    int subject_count;           //   (-1̸ Ľ  )
+} IngestRow;
+
+// ûũ Ľ  (帶   ̹Ƿ  )
+//  ûũ   ΰ     ID ٲ
+typedef struct {
+    const char *start;           // Ľ  ڵ 
+    const char *stop;            // Ľ ģ ڵ  ( ûũ ؾ  ġ)
+    int lines;                   // [start, stop)  ٹٲ 
+    IngestRow *rows;
+    int row_count;
+    int row_capacity;
+    Grade *grades;               //    ( ID ûũ  )
+    int grade_count;
+    int grade_capacity;
+    StringDict subjects;         // ûũ  
+    int failed;                  // 1̸ ޸  ߰ 
+} IngestChunk;
+
+//  ε ۾ -   INGEST_UNIT Ʈ   ûũ ۾ ѱ
+typedef struct {
+    const char *data;            //    (  ڵ)
+    const char *end;             //  
+    IngestChunk *chunks;
+} IngestJob;
+
+// ۾  ȣ شϴ  ġ
+static const char* ingest_unit_pointer(const IngestJob *job, int unit) {
+    size_t offset = (size_t)unit * INGEST_UNIT;
+    size_t size = (size_t)(job->end - job->data);
+    return job->data + (offset < size ? offset : size);
+}
+
+// ûũ   (  ,  Ŀ  ûũ ٽ   )
+static void free_ingest_chunk(IngestChunk *chunk) {
+    free(chunk->rows);
+    free(chunk->grades);
+    destroy_dictionary(&chunk->subjects);
+    memset(chunk, 0, sizeof(IngestChunk));
+    init_dictionary(&chunk->subjects);
+}
+
+// ûũ  ϳ ߰ ( record  迭 ) - ޸ ̸ 0 ȯ
+static int push_ingest_row(IngestChunk *chunk, const StudentRecord *record, int line_number, int parsed) {
+    if (chunk->row_count == chunk->row_capacity) {
+        int capacity = chunk->row_capacity > 0 ? chunk->row_capacity * 2 : 1024;
+        IngestRow *rows = (IngestRow*)realloc(chunk->rows, sizeof(IngestRow) * capacity);
+        if (!rows) return 0;
+        chunk->rows = rows;
+        chunk->row_capacity = capacity;
+    }
     
-    // CSV ʵ 
-    char *token;
-    int field = 0;
-    char *saveptr;
+    int count = parsed ? record->subject_count : 0;
+    if (chunk->grade_count + count > chunk->grade_capacity) {
+        int capacity = chunk->grade_capacity > 0 ? chunk->grade_capacity : 4096;
+        while (capacity < chunk->grade_count + count) capacity *= 2;
+        Grade *grades = (Grade*)realloc(chunk->grades, sizeof(Grade) * capacity);
+        if (!grades) return 0;
+        chunk->grades = grades;
+        chunk->grade_capacity = capacity;
+    }
     
-    token = strtok_r(line_copy, ",", &saveptr);
+    IngestRow *row = &chunk->rows[chunk->row_count++];
+    row->line_number = line_number;
+    row->grade_begin = chunk->grade_count;
+    row->subject_count = parsed ? count : -1;
+    if (parsed) {
+        row->info = record->info;
+        if (count > 0) {
+            memcpy(chunk->grades + chunk->grade_count, record->grades, sizeof(Grade) * count);
+        }
+        chunk->grade_count += count;
+    }
+    return 1;
+}
+
+// [start, ...) limit  ϴ ڵ带  ĽϿ ûũ ۿ 
+//  ڵ limit Ѿ   ,  ġ chunk->stop
+static void parse_ingest_range(const IngestJob *job, IngestChunk *chunk, const char *start, const char *limit) {
+    CsvReader reader;
+    init_csv_reader(&reader, start, (size_t)(job->end - start));
+    reader.subjects = &chunk->subjects;
     
-    while (token && field < 5) {
-        token = trim_whitespace(token);
+    StudentRecord record;
+    init_parse_record(&record);
+    while (reader.pos < limit && next_csv_record(&reader)) {
+        if (is_blank_record(&reader)) continue;
         
-        switch (field) {
-            case 0: // ID
-                record->info.id = atoi(token);
-                break;
-            case 1: // Name
-                strncpy(record->info.name, token, MAX_NAME_LEN - 1);
-                record->info.name[MAX_NAME_LEN - 1] = '\0';
-                break;
-            case 2: // Major
-                strncpy(record->info.major, token, MAX_MAJOR_LEN - 1);
-                record->info.major[MAX_MAJOR_LEN - 1] = '\0';
-                break;
-            case 3: // Reg_date
-                strncpy(record->info.reg_date, token, 10);
-                record->info.reg_date[10] = '\0';
-                break;
-            case 4: // Grades
-                parse_grades_string(token, record);
+        int parsed = parse_student_fields(&reader, &record, 0);
+        if (!push_ingest_row(chunk, &record, reader.line_number, parsed)) {
+            chunk->failed = 1;
+            break;
+        }
+    }
+    release_grades(&record);
+    
+    chunk->start = start;
+    chunk->stop = reader.pos;
+    chunk->lines = reader.lines_read;
+}
+
+// ûũ ۾ - ûũ    ù   Ľ (0 ûũ   ۺ)
+//  谡 ǥ  ٹٲ  Ƿ,  ûũ   ġ ٸ   ٽ Ľ
+static void ingest_chunk(void *context, int chunk, int begin, int end) {
+    IngestJob *job = (IngestJob*)context;
+    const char *start = ingest_unit_pointer(job, begin);
+    const char *limit = ingest_unit_pointer(job, end);
+    
+    if (chunk > 0) {
+        const char *newline = (const char*)memchr(start - 1, '\n', (size_t)(limit - start + 1));
+        start = newline ? newline + 1 : limit;
+    }
+    parse_ingest_range(job, &job->chunks[chunk], start, limit);
+}
+
+// ڵ б ġ   ڵ带 ûũ   Ľ    ڿ ߰
+// ߺ й ϸ鼭 ɷǷ Ͽ   л 
+// importing 0̸ load_data, 1̸ import_from_csv   
+// ߰ л  ȯ (ߺ ǳʶ  *skipped )
+static int ingest_csv_records(StudentManager *manager, const CsvReader *reader, int importing, int *skipped) {
+    IngestJob job = { reader->pos, reader->end, NULL };
+    size_t size = (size_t)(job.end - job.data);
+    int units = (int)((size + INGEST_UNIT - 1) / INGEST_UNIT);
+    int chunk_count = parallel_chunk_count(units, INGEST_CHUNK_UNITS);
+    if (chunk_count == 0) return 0;
+    
+    job.chunks = (IngestChunk*)calloc((size_t)chunk_count, sizeof(IngestChunk));
+    if (!job.chunks) {
+        fprintf(stderr, "޸ Ҵ : CSV ûũ\n");
+        return 0;
+    }
+    for (int i = 0; i < chunk_count; i++) {
+        init_dictionary(&job.chunks[i].subjects);
+    }
+    
+    parallel_for_chunks(units, INGEST_CHUNK_UNITS, ingest_chunk, &job);
+    
+    //   
+    int added = 0;
+    int line_base = reader->lines_read;
+    const char *expected = job.data;
+    int stopped = 0;
+    for (int i = 0; i < chunk_count && !stopped; i++) {
+        IngestChunk *chunk = &job.chunks[i];
+        
+        //  ûũ ٸ ġ  (ǥ  ٹٲ޿  )   ٽ Ľ
+        if (chunk->start != expected) {
+            int unit_end = (i + 1 < chunk_count) ? (i + 1) * INGEST_CHUNK_UNITS : units;
+            const char *limit = ingest_unit_pointer(&job, unit_end);
+            free_ingest_chunk(chunk);
+            parse_ingest_range(&job, chunk, expected, limit > expected ? limit : expected);
+        }
+        expected = chunk->stop;
+        
+        // ûũ  ID ->   ID
+        int *subject_map = NULL;
+        if (chunk->subjects.count > 0) {
+            subject_map = (int*)malloc(sizeof(int) * chunk->subjects.count);
+            if (!subject_map) {
+                fprintf(stderr, "޸ Ҵ :  ID ȯǥ\n");
+                stopped = 1;
+            }
+            //     ϸ (޸ )  ûũ ߴ
+            for (int s = 0; subject_map && !stopped && s < chunk->subjects.count; s++) {
+                subject_map[s] = intern_subject(get_string(&chunk->subjects, s));
+                if (subject_map[s] == -1) stopped = 1;
+            }
+        }
+        
+        if (!stopped && !reserve_students(manager, manager->slot_count + chunk->row_count)) {
+            stopped = 1;
+        }
+        for (int r = 0; r < chunk->row_count && !stopped; r++) {
+            IngestRow *row = &chunk->rows[r];
+            if (row->subject_count < 0) {
+                if (!importing) {
+                    fprintf(stderr, ":  %d Ľ \n", line_base + row->line_number);
+                }
+                continue;
+            }
+            
+            // ߺ й ˻ (й ε O(1))
+            if (is_duplicate_id(manager, row->info.id)) {
+                if (importing) {
+                    fprintf(stderr, ": й %d ̹ մϴ. ǳʶ.\n", row->info.id);
+                } else {
+                    fprintf(stderr, ": й %d ߺǾ ǳʶݴϴ.\n", row->info.id);
+                }
+                (*skipped)++;
+                continue;
+            }
+            
+            StudentRecord record;
+            init_parse_record(&record);
+            record.info = row->info;
+            record.grades = chunk->grades + row->grade_begin;
+            record.subject_count = row->subject_count;
+            for (int g = 0; g < record.subject_count; g++) {
+                record.grades[g].subject_id = subject_map[record.grades[g].subject_id];
+            }
+            if (!append_student_record(manager, &record)) {
+                stopped = 1;
                 break;
+            }
+            added++;
+        }
+        if (chunk->failed) stopped = 1;
+        if (stopped) {
+            fprintf(stderr, importing ? ": ޸ .  ̻ ߰  ϴ.\n"
+                                      : ": ޸ .  ̻   ϴ.\n");
         }
         
-        field++;
-        token = strtok_r(NULL, ",", &saveptr);
+        line_base += chunk->lines;
+        free(subject_map);
+        free_ingest_chunk(chunk);    //  ûũ ۴ ٷ Ͽ ִ ޸𸮸 
+    }
+    
+    for (int i = 0; i < chunk_count; i++) {
+        free_ingest_chunk(&job.chunks[i]);
+    }
+    free(job.chunks);
+    return added;
+}
+
+// ǥ ʵ ȿ  ڿ  (" "")
+static void write_escaped(FILE *file, const char *text) {
+    const char *quote;
+    while ((quote = strchr(text, '"')) != NULL) {
+        fwrite(text, 1, (size_t)(quote - text) + 1, file);
+        fputc('"', file);
+        text = quote + 1;
+    }
+    fputs(text, file);
+}
+
+// CSV ʵ  - , ǥ, ٹٲ ְų յ   ǥ 
+static void write_csv_field(FILE *file, const char *text) {
+    size_t length = strlen(text);
+    int quote = strpbrk(text, ",\"\r\n") != NULL ||
+                (length > 0 && (text[0] == ' ' || text[0] == '\t' ||
+                                text[length - 1] == ' ' || text[length - 1] == '\t'));
+    if (!quote) {
+        fputs(text, file);
+        return;
     }
     
-    return (field >= 4); // ּ 4 ʵ ־ 
+    fputc('"', file);
+    write_escaped(file, text);
+    fputc('"', file);
 }
 
 // ͸ CSV Ϸ 
@@ -144,22 +852,25 @@ int save_data(const StudentManager *manager, const char *filename) {
     fprintf(file, "ID,Name,Major,Reg_Date,Grades\n");
     
     //  л  
-    for (int i = 0; i < manager->count; i++) {
-        StudentRecord *record = &manager->records[i];
+    for (int i = 0; i < manager->slot_count; i++) {
+        StudentRecord *record = get_record(manager, i);
+        if (record->deleted) continue;
         
-        // ⺻  ۼ
-        fprintf(file, "%d,%s,%s,%s,",
-                record->info.id,
-                record->info.name,
-                record->info.major,
-                record->info.reg_date);
+        // ⺻  ۼ (ʿ ʵ常 ǥ )
+        fprintf(file, "%d,", record->info.id);
+        write_csv_field(file, record->info.name);
+        fputc(',', file);
+        write_csv_field(file, record->info.major);
+        fputc(',', file);
+        write_csv_field(file, record->info.reg_date);
+        fputc(',', file);
         
         //   ۼ (: "::;::")
         if (record->subject_count > 0) {
             fprintf(file, "\"");
             for (int j = 0; j < record->subject_count; j++) {
-                fprintf(file, "%s:%.1f:%d",
-                        record->grades[j].subject,
+                write_escaped(file, get_subject_name(record->grades[j].subject_id));
+                fprintf(file, ":%.1f:%d",
                         record->grades[j].score,
                         record->grades[j].credit);
                 
@@ -179,42 +890,32 @@ int save_data(const StudentManager *manager, const char *filename) {
 }
 
 // CSV Ͽ  ε
+//  ޸ Ͽ ڵ带  ʰ ڸ Ľ (ū  ûũ  Ľ)
 int load_data(StudentManager *manager, const char *filename) {
-    FILE *file = fopen(filename, "r");
-    if (!file) {
+    CsvFile file;
+    if (!open_csv_file(filename, &file)) {
         fprintf(stderr, ":  '%s'   ϴ.\n", filename);
         return 0;
     }
     
-    char line[2048];
-    int loaded_count = 0;
+    CsvReader reader;
+    init_csv_reader(&reader, file.data, file.size);
     
     //   ǳʶٱ
-    if (!fgets(line, sizeof(line), file)) {
+    if (!next_csv_record(&reader)) {
         fprintf(stderr, ":  ְų  ߸Ǿϴ.\n");
-        fclose(file);
+        close_csv_file(&file);
         return 0;
     }
     
     //   ʱȭ
-    manager->count = 0;
+    clear_students(manager);
     
-    //   а Ľ
-    while (fgets(line, sizeof(line), file) && manager->count < manager->capacity) {
-        //   ǳʶٱ
-        if (strlen(trim_whitespace(line)) == 0) continue;
-        
-        StudentRecord *record = &manager->records[manager->count];
-        
-        if (parse_student_line(line, record)) {
-            manager->count++;
-            loaded_count++;
-        } else {
-            fprintf(stderr, ":  %d Ľ \n", loaded_count + 2);
-        }
-    }
-    
-    fclose(file);
+    // ڵ带 ûũ  Ľ    ߰ (ް GPA ü ε  ϰ )
+    int duplicate_count = 0;
+    int loaded_count = ingest_csv_records(manager, &reader, 0, &duplicate_count);
+    close_csv_file(&file);
+    recalculate_all_gpa(manager);
     printf("Ͱ '%s' εǾϴ. ( %d)\n", filename, loaded_count);
     return 1;
 }
@@ -275,55 +976,889 @@ int import_from_csv(StudentManager *manager, const char *filename) {
         return 0;
     }
     
-    FILE *file = fopen(filename, "r");
-    if (!file) {
+    CsvFile file;
+    if (!open_csv_file(filename, &file)) {
         fprintf(stderr, ":    ϴ.\n");
         return 0;
     }
     
-    char line[2048];
-    int imported_count = 0;
+    CsvReader reader;
+    init_csv_reader(&reader, file.data, file.size);
     int skipped_count = 0;
     
     //  ǳʶٱ
-    fgets(line, sizeof(line), file);
+    next_csv_record(&reader);
     
     //  л  
     int original_count = manager->count;
     
-    //   а ߰
-    while (fgets(line, sizeof(line), file)) {
-        if (strlen(trim_whitespace(line)) == 0) continue;
-        
-        StudentRecord temp_record;
-        if (parse_student_line(line, &temp_record)) {
-            // ߺ й ˻
-            if (is_duplicate_id(manager, temp_record.info.id)) {
-                fprintf(stderr, ": й %d ̹ մϴ. ǳʶ.\n", 
-                        temp_record.info.id);
-                skipped_count++;
-                continue;
+    //  ڵ带 ûũ  Ľ    ߰ (ߺ й ǳʶ)
+    int imported_count = ingest_csv_records(manager, &reader, 1, &skipped_count);
+    close_csv_file(&file);
+    recalculate_all_gpa(manager);
+    
+    printf("\n Ϸ:\n");
+    printf("- ߰ л: %d\n", imported_count);
+    printf("- ǳʶ л: %d\n", skipped_count);
+    printf("-   л : %d\n", manager->count);
+    
+    return 1;
+}
+
+//   (  , ڵ  ũ⸦  )
+typedef struct {
+    char magic[8];               // SNAPSHOT_MAGIC
+    uint32_t version;            // SNAPSHOT_VERSION
+    uint32_t header_size;        // sizeof(SnapshotHeader)
+    uint32_t record_count;       // л 
+    uint32_t grade_count;        // ü  
+    uint32_t subject_count;      //  
+    uint32_t major_count;        //  
+    uint32_t id_table_size;      // й ε ĭ  (2 ŵ)
+    uint32_t dict_size;          // /  Ʈ 
+    uint32_t heap_size;          // ̸  Ʈ 
+    uint32_t reserved;
+    uint64_t hot_checksum;       //   üũ
+    uint64_t checksum;           // ݵ  üũ
+} SnapshotHeader;
+
+//   (  16Ʈ)
+typedef struct {
+    uint32_t subject;            //  ȣ (  ǥ )
+    float score;
+    int32_t credit;
+    int32_t grade;               //  
+} SnapshotGrade;
+
+//   ġ -  ڿ  , ݵ   ̾
+//    ε  ٷ д й ε  ÷̰, ݵ  ڵ带 ó ä  
+// ݵ  8Ʈ 迡 ϰ 8Ʈ  տ ξ   ĵ
+typedef struct {
+    const int32_t *id;           // й [record_count]
+    const float *gpa;            //   [record_count]
+    const uint32_t *major;       //  ȣ [record_count]
+    const uint32_t *grade_begin; // л   ġ [record_count + 1]
+    const uint32_t *record_check; // л ݵ  üũ [record_count] (snapshot_record_checksum)
+    const uint32_t *subject_name; //    ġ [subject_count]
+    const uint32_t *major_name;  //    ġ [major_count]
+    const int32_t *id_table;     // й ->  ȣ ؽ ̺ [id_table_size] ( й ε  )
+    const char *dict;            // /  [dict_size]
+    const double *weighted_sum;  //  x  հ [record_count]
+    const int32_t *total_credits; //  ̼  [record_count]
+    const uint32_t *name;        // ̸  ġ [record_count]
+    const SnapshotGrade *grades; //  [grade_count]
+    const char *reg_date;        //  [record_count][SNAPSHOT_DATE_LEN]
+    const char *heap;            // 0  ̸ [heap_size]
+    uint64_t hot_size;           //   ũ ( ,  Ŀ  Ʈ )
+    uint64_t size;               //   ü  ũ
+} SnapshotLayout;
+
+//     ġ ü ũ  (base NULL̸ ũ⸸ ǹ )
+static void snapshot_layout(const SnapshotHeader *header, const char *base, SnapshotLayout *layout) {
+    uint64_t n = header->record_count;
+    uint64_t offset = sizeof(SnapshotHeader);
+    
+#define SNAPSHOT_SECTION(field, type, count) \
+    layout->field = (const type*)(base ? base + offset : NULL); \
+    offset += sizeof(type) * (uint64_t)(count)
+    
+    SNAPSHOT_SECTION(id, int32_t, n);
+    SNAPSHOT_SECTION(gpa, float, n);
+    SNAPSHOT_SECTION(major, uint32_t, n);
+    SNAPSHOT_SECTION(grade_begin, uint32_t, n + 1);
+    SNAPSHOT_SECTION(record_check, uint32_t, n);
+    SNAPSHOT_SECTION(subject_name, uint32_t, header->subject_count);
+    SNAPSHOT_SECTION(major_name, uint32_t, header->major_count);
+    SNAPSHOT_SECTION(id_table, int32_t, header->id_table_size);
+    SNAPSHOT_SECTION(dict, char, header->dict_size);
+    offset = (offset + 7) & ~(uint64_t)7;
+    layout->hot_size = offset - sizeof(SnapshotHeader);
+    
+    SNAPSHOT_SECTION(weighted_sum, double, n);
+    SNAPSHOT_SECTION(total_credits, int32_t, n);
+    SNAPSHOT_SECTION(name, uint32_t, n);
+    SNAPSHOT_SECTION(grades, SnapshotGrade, header->grade_count);
+    SNAPSHOT_SECTION(reg_date, char, n * SNAPSHOT_DATE_LEN);
+    SNAPSHOT_SECTION(heap, char, header->heap_size);
+    
+#undef SNAPSHOT_SECTION
+    layout->size = offset;
+}
+
+//  üũ - 8Ʈ 带     (Ʈ  ؽú   )
+typedef struct {
+    uint64_t lane[4];
+    uint64_t length;
+} SnapshotChecksum;
+
+#define CHECKSUM_PRIME1 0x9E3779B185EBCA87ULL
+#define CHECKSUM_PRIME2 0xC2B2AE3D27D4EB4FULL
+
+static uint64_t checksum_round(uint64_t lane, uint64_t word) {
+    lane += word * CHECKSUM_PRIME2;
+    lane = (lane << 31) | (lane >> 33);
+    return lane * CHECKSUM_PRIME1;
+}
+
+static void checksum_init(SnapshotChecksum *checksum) {
+    checksum->lane[0] = CHECKSUM_PRIME1 + CHECKSUM_PRIME2;
+    checksum->lane[1] = CHECKSUM_PRIME2;
+    checksum->lane[2] = 0;
+    checksum->lane[3] = 0 - CHECKSUM_PRIME1;
+    checksum->length = 0;
+}
+
+// üũ  ߰ - 32Ʈ  ƴ ̴  ȣ⿡ 
+static void checksum_update(SnapshotChecksum *checksum, const unsigned char *data, size_t size) {
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        for (int k = 0; k < 4; k++) {
+            uint64_t word;
+            memcpy(&word, data + i + k * 8, sizeof(word));
+            checksum->lane[k] = checksum_round(checksum->lane[k], word);
+        }
+    }
+    for (; i < size; i++) {
+        checksum->lane[0] = checksum_round(checksum->lane[0], data[i]);
+    }
+    checksum->length += size;
+}
+
+static uint64_t checksum_final(const SnapshotChecksum *checksum) {
+    uint64_t h = checksum->length;
+    for (int k = 0; k < 4; k++) {
+        h = checksum_round(h ^ checksum->lane[k], checksum->lane[k]);
+    }
+    h ^= h >> 29;
+    h *= CHECKSUM_PRIME1;
+    return h ^ (h >> 32);
+}
+
+// ޸ [data, data + size) üũ
+static uint64_t checksum_bytes(const char *data, uint64_t size) {
+    SnapshotChecksum checksum;
+    checksum_init(&checksum);
+    checksum_update(&checksum, (const unsigned char*)data, (size_t)size);
+    return checksum_final(&checksum);
+}
+
+// л   ݵ  üũ - ,  , ̸ ġ ̸,  8Ʈ  4Ʈ 
+//     ึ ϰ,  ε   ó ä    ˻
+// (ݵ  ü üũ ϰ ε常 ˻ϹǷ  ε   ݵ   )
+//  RECORD_CHECKSUM_SEED  mix_snapshot_grade ʷ   snapshot_record_checksum 
+#define RECORD_CHECKSUM_SEED CHECKSUM_PRIME1
+
+static uint64_t mix_snapshot_grade(uint64_t h, const SnapshotGrade *grade) {
+    uint64_t halves[2];
+    memcpy(halves, grade, sizeof(halves));
+    h = checksum_round(h, halves[0]);
+    return checksum_round(h, halves[1]);
+}
+
+static uint32_t snapshot_record_checksum(uint64_t h, double weighted_sum, int32_t total_credits,
+                                         uint32_t name_offset, const char *name, const char *date) {
+    uint64_t word;
+    memcpy(&word, &weighted_sum, sizeof(word));
+    h = checksum_round(h, word);
+    h = checksum_round(h, ((uint64_t)(uint32_t)total_credits << 32) | name_offset);
+    
+    //   , ̸  0 8Ʈ  ( ڸ 0)
+    char date_words[16] = { 0 };
+    memcpy(date_words, date, SNAPSHOT_DATE_LEN);
+    for (int i = 0; i < 16; i += 8) {
+        memcpy(&word, date_words + i, sizeof(word));
+        h = checksum_round(h, word);
+    }
+    size_t name_len = strlen(name) + 1;
+    for (size_t i = 0; i < name_len; i += 8) {
+        word = 0;
+        memcpy(&word, name + i, name_len - i < 8 ? name_len - i : 8);
+        h = checksum_round(h, word);
+    }
+    
+    h ^= h >> 29;
+    h *= CHECKSUM_PRIME1;
+    return (uint32_t)(h ^ (h >> 32));
+}
+
+//    -    üũ ϰ Ͽ 
+typedef struct {
+    FILE *file;
+    unsigned char buffer[SNAPSHOT_BUFFER];
+    size_t used;
+    uint64_t written;            //  ڷ  Ʈ 
+    SnapshotChecksum checksum;
+    int failed;                  //   ߻ 
+} SnapshotWriter;
+
+static void snapshot_flush(SnapshotWriter *writer) {
+    checksum_update(&writer->checksum, writer->buffer, writer->used);
+    if (writer->used > 0 && fwrite(writer->buffer, 1, writer->used, writer->file) != writer->used) {
+        writer->failed = 1;
+    }
+    writer->used = 0;
+}
+
+static void snapshot_write(SnapshotWriter *writer, const void *data, size_t size) {
+    const unsigned char *bytes = (const unsigned char*)data;
+    writer->written += size;
+    while (size > 0) {
+        size_t room = SNAPSHOT_BUFFER - writer->used;
+        size_t length = size < room ? size : room;
+        memcpy(writer->buffer + writer->used, bytes, length);
+        writer->used += length;
+        bytes += length;
+        size -= length;
+        if (writer->used == SNAPSHOT_BUFFER) snapshot_flush(writer);
+    }
+}
+
+static void snapshot_write_u32(SnapshotWriter *writer, uint32_t value) {
+    snapshot_write(writer, &value, sizeof(value));
+}
+
+// ݱ   üũ ϰ   üũ  
+static uint64_t snapshot_end_region(SnapshotWriter *writer) {
+    snapshot_flush(writer);
+    uint64_t checksum = checksum_final(&writer->checksum);
+    checksum_init(&writer->checksum);
+    return checksum;
+}
+
+//   ȣ ǥ -      ȣ ű
+typedef struct {
+    int *index;                  //   ID ->  ȣ (-1̸  )
+    int index_size;
+    int *ids;                    //  ȣ ->   ID
+    int count;
+    int capacity;
+} SnapshotSubjects;
+
+//   ȣ (ó  ̸  ȣ) - ޸ ̸ -1 ȯ
+static int snapshot_subject(SnapshotSubjects *subjects, int subject_id) {
+    if (subject_id >= subjects->index_size) {
+        int new_size = subjects->index_size > 0 ? subjects->index_size : 64;
+        while (new_size <= subject_id) new_size *= 2;
+        int *index = (int*)realloc(subjects->index, sizeof(int) * new_size);
+        if (!index) return -1;
+        for (int i = subjects->index_size; i < new_size; i++) index[i] = -1;
+        subjects->index = index;
+        subjects->index_size = new_size;
+    }
+    if (subjects->index[subject_id] != -1) return subjects->index[subject_id];
+    
+    if (subjects->count == subjects->capacity) {
+        int new_capacity = subjects->capacity > 0 ? subjects->capacity * 2 : 64;
+        int *ids = (int*)realloc(subjects->ids, sizeof(int) * new_capacity);
+        if (!ids) return -1;
+        subjects->ids = ids;
+        subjects->capacity = new_capacity;
+    }
+    subjects->ids[subjects->count] = subject_id;
+    subjects->index[subject_id] = subjects->count;
+    return subjects->count++;
+}
+
+// л  (  ,  ټ   )
+enum {
+    SNAPSHOT_COLUMN_ID,
+    SNAPSHOT_COLUMN_GPA,
+    SNAPSHOT_COLUMN_MAJOR,
+    SNAPSHOT_COLUMN_GRADE_BEGIN,
+    SNAPSHOT_COLUMN_RECORD_CHECK,
+    SNAPSHOT_HOT_COLUMNS,
+    SNAPSHOT_COLUMN_WEIGHTED_SUM = SNAPSHOT_HOT_COLUMNS,
+    SNAPSHOT_COLUMN_TOTAL_CREDITS,
+    SNAPSHOT_COLUMN_NAME,
+    SNAPSHOT_COLUMN_GRADES,
+    SNAPSHOT_RECORD_COLUMNS
+};
+
+//  ϳ   ȯ
+static void to_snapshot_grade(const SnapshotSubjects *subjects, const Grade *grade, SnapshotGrade *out) {
+    out->subject = (uint32_t)subjects->index[grade->subject_id];
+    out->score = grade->score;
+    out->credit = grade->credit;
+    out->grade = grade->grade;
+}
+
+//      (0 ä  Ʈ ׻ 0)
+static void to_snapshot_date(const char *reg_date, char date[SNAPSHOT_DATE_LEN]) {
+    memset(date, 0, SNAPSHOT_DATE_LEN);
+    const char *end = (const char*)memchr(reg_date, '\0', SNAPSHOT_DATE_LEN - 1);
+    memcpy(date, reg_date, end ? (size_t)(end - reg_date) : SNAPSHOT_DATE_LEN - 1);
+}
+
+//  ڵ  üũ (name_offset ̸  ġ) -   ο   ƾ 
+static uint32_t record_checksum_of(const SnapshotSubjects *subjects, const StudentRecord *record,
+                                   uint32_t name_offset) {
+    uint64_t h = RECORD_CHECKSUM_SEED;
+    for (int i = 0; i < record->subject_count; i++) {
+        SnapshotGrade out;
+        to_snapshot_grade(subjects, &record->grades[i], &out);
+        h = mix_snapshot_grade(h, &out);
+    }
+    char date[SNAPSHOT_DATE_LEN];
+    to_snapshot_date(record->info.reg_date, date);
+    return snapshot_record_checksum(h, record->weighted_sum, record->total_credits,
+                                    name_offset, record->info.name, date);
+}
+
+// л  [first, last) ϳ  (    )
+static void write_snapshot_columns(SnapshotWriter *writer, const StudentManager *manager,
+                                   const SnapshotSubjects *subjects, int first, int last) {
+    for (int column = first; column < last; column++) {
+        uint32_t running = 0;
+    
+        for (int slot = 0; slot < manager->slot_count; slot++) {
+            const StudentRecord *record = get_record(manager, slot);
+            if (record->deleted) continue;
+    
+            switch (column) {
+                case SNAPSHOT_COLUMN_ID:
+                    snapshot_write_u32(writer, (uint32_t)record->info.id);
+                    break;
+                case SNAPSHOT_COLUMN_GPA:
+                    snapshot_write(writer, &record->gpa, sizeof(float));
+                    break;
+                case SNAPSHOT_COLUMN_MAJOR:
+                    snapshot_write_u32(writer, (uint32_t)manager->hot.major_id[slot]);
+                    break;
+                case SNAPSHOT_COLUMN_GRADE_BEGIN:
+                    snapshot_write_u32(writer, running);
+                    running += (uint32_t)record->subject_count;
+                    break;
+                case SNAPSHOT_COLUMN_RECORD_CHECK:
+                    // running ̸   ̸  ġ
+                    snapshot_write_u32(writer, record_checksum_of(subjects, record, running));
+                    running += (uint32_t)strlen(record->info.name) + 1;
+                    break;
+                case SNAPSHOT_COLUMN_WEIGHTED_SUM:
+                    snapshot_write(writer, &record->weighted_sum, sizeof(double));
+                    break;
+                case SNAPSHOT_COLUMN_TOTAL_CREDITS:
+                    snapshot_write_u32(writer, (uint32_t)record->total_credits);
+                    break;
+                case SNAPSHOT_COLUMN_NAME:
+                    snapshot_write_u32(writer, running);
+                    running += (uint32_t)strlen(record->info.name) + 1;
+                    break;
+                case SNAPSHOT_COLUMN_GRADES:
+                    for (int i = 0; i < record->subject_count; i++) {
+                        SnapshotGrade out;
+                        to_snapshot_grade(subjects, &record->grades[i], &out);
+                        snapshot_write(writer, &out, sizeof(out));
+                    }
+                    break;
             }
-            
-            // 뷮 Ȯ
-            if (manager->count >= manager->capacity) {
-                fprintf(stderr, ": ִ 뷮 ʰ.  ̻ ߰  ϴ.\n");
+        }
+    
+        //   ġ   ġ ϳ  
+        if (column == SNAPSHOT_COLUMN_GRADE_BEGIN) snapshot_write_u32(writer, running);
+    }
+}
+
+//  ִ л й    й ε  -   NULL ȯ
+static int* build_snapshot_id_table(const StudentManager *manager, int size) {
+    int *ids = (int*)malloc(sizeof(int) * (manager->count + 1));
+    int *table = (int*)malloc(sizeof(int) * size);
+    if (!ids || !table) {
+        free(ids);
+        free(table);
+        return NULL;
+    }
+    
+    int n = 0;
+    for (int slot = 0; slot < manager->slot_count; slot++) {
+        if (manager->hot.live[slot]) ids[n++] = manager->hot.id[slot];
+    }
+    fill_id_index(table, size, ids, n);
+    free(ids);
+    return table;
+}
+
+//  ͸    -   1,   0 ȯ
+// ӽ Ͽ    ̸ ٲٹǷ   ص   ״ 
+//  Ʈ  float/double   迡   
+int save_snapshot(const StudentManager *manager, const char *filename) {
+    // ӽ  ̸ ߸      Ƿ  
+    char temp_name[512];
+    int temp_len = snprintf(temp_name, sizeof(temp_name), "%s.tmp", filename);
+    if (temp_len < 0 || (size_t)temp_len >= sizeof(temp_name)) {
+        fprintf(stderr, ":  ̸ '%s'() ʹ ϴ.\n", filename);
+        return 0;
+    }
+    
+    //   ȣ ű    ũ  (  : , )
+    SnapshotSubjects subjects = { NULL, 0, NULL, 0, 0 };
+    uint64_t grade_count = 0;
+    uint64_t name_bytes = 0;
+    int ok = 1;
+    
+    for (int slot = 0; slot < manager->slot_count && ok; slot++) {
+        const StudentRecord *record = get_record(manager, slot);
+        if (record->deleted) continue;
+    
+        grade_count += (uint64_t)record->subject_count;
+        name_bytes += strlen(record->info.name) + 1;
+        for (int i = 0; i < record->subject_count; i++) {
+            if (snapshot_subject(&subjects, record->grades[i].subject_id) == -1) {
+                fprintf(stderr, "޸ Ҵ :   ǥ\n");
+                ok = 0;
                 break;
             }
-            
-            // л ߰
-            manager->records[manager->count] = temp_record;
-            manager->count++;
-            imported_count++;
         }
     }
     
-    fclose(file);
+    uint64_t subject_bytes = 0;
+    for (int i = 0; i < subjects.count; i++) {
+        subject_bytes += strlen(get_subject_name(subjects.ids[i])) + 1;
+    }
+    uint64_t major_bytes = 0;
+    for (int i = 0; i < manager->majors.count; i++) {
+        major_bytes += strlen(get_string(&manager->majors, i)) + 1;
+    }
     
-    printf("\n Ϸ:\n");
-    printf("- ߰ л: %d\n", imported_count);
-    printf("- ǳʶ л: %d\n", skipped_count);
-    printf("-   л : %d\n", manager->count);
+    int table_size = id_index_size(manager->count);
+    if (ok && (grade_count > UINT32_MAX || subject_bytes + major_bytes > UINT32_MAX ||
+               name_bytes > UINT32_MAX || table_size == -1)) {
+        fprintf(stderr, ": Ͱ ʹ Ŀ    ϴ.\n");
+        ok = 0;
+    }
+    
+    SnapshotWriter *writer = NULL;
+    int *id_table = NULL;
+    FILE *file = NULL;
+    if (ok) {
+        writer = (SnapshotWriter*)malloc(sizeof(SnapshotWriter));
+        id_table = build_snapshot_id_table(manager, table_size);
+        if (!writer || !id_table) {
+            fprintf(stderr, "޸ Ҵ :   \n");
+            ok = 0;
+        } else if (!(file = fopen(temp_name, "wb"))) {
+            fprintf(stderr, ":  '%s'   ϴ.\n", temp_name);
+            ok = 0;
+        }
+    }
+    if (!ok) {
+        free(writer);
+        free(id_table);
+        free(subjects.index);
+        free(subjects.ids);
+        return 0;
+    }
+    
+    SnapshotHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.version = SNAPSHOT_VERSION;
+    header.header_size = sizeof(SnapshotHeader);
+    header.record_count = (uint32_t)manager->count;
+    header.grade_count = (uint32_t)grade_count;
+    header.subject_count = (uint32_t)subjects.count;
+    header.major_count = (uint32_t)manager->majors.count;
+    header.id_table_size = (uint32_t)table_size;
+    header.dict_size = (uint32_t)(subject_bytes + major_bytes);
+    header.heap_size = (uint32_t)name_bytes;
     
+    //  ڸ ϴ ״  üũ   ٽ 
+    writer->file = file;
+    writer->used = 0;
+    writer->written = 0;
+    writer->failed = fwrite(&header, sizeof(header), 1, file) != 1;
+    checksum_init(&writer->checksum);
+    
+    //  :  , /  ġ, й ε,  , 8Ʈ Ŀ  Ʈ
+    write_snapshot_columns(writer, manager, &subjects, 0, SNAPSHOT_HOT_COLUMNS);
+    uint32_t offset = 0;
+    for (int i = 0; i < subjects.count; i++) {
+        snapshot_write_u32(writer, offset);
+        offset += (uint32_t)strlen(get_subject_name(subjects.ids[i])) + 1;
+    }
+    for (int i = 0; i < manager->majors.count; i++) {
+        snapshot_write_u32(writer, offset);
+        offset += (uint32_t)strlen(get_string(&manager->majors, i)) + 1;
+    }
+    snapshot_write(writer, id_table, sizeof(int) * (size_t)table_size);
+    for (int i = 0; i < subjects.count; i++) {
+        const char *name = get_subject_name(subjects.ids[i]);
+        snapshot_write(writer, name, strlen(name) + 1);
+    }
+    for (int i = 0; i < manager->majors.count; i++) {
+        const char *name = get_string(&manager->majors, i);
+        snapshot_write(writer, name, strlen(name) + 1);
+    }
+    static const char padding[8] = { 0 };
+    snapshot_write(writer, padding, (size_t)((8 - writer->written % 8) % 8));
+    header.hot_checksum = snapshot_end_region(writer);
+    
+    // ݵ : ݵ , , ̸ 
+    write_snapshot_columns(writer, manager, &subjects, SNAPSHOT_HOT_COLUMNS, SNAPSHOT_RECORD_COLUMNS);
+    for (int slot = 0; slot < manager->slot_count; slot++) {
+        const StudentRecord *record = get_record(manager, slot);
+        if (record->deleted) continue;
+        char date[SNAPSHOT_DATE_LEN];
+        to_snapshot_date(record->info.reg_date, date);
+        snapshot_write(writer, date, SNAPSHOT_DATE_LEN);
+    }
+    for (int slot = 0; slot < manager->slot_count; slot++) {
+        const StudentRecord *record = get_record(manager, slot);
+        if (!record->deleted) snapshot_write(writer, record->info.name, strlen(record->info.name) + 1);
+    }
+    header.checksum = snapshot_end_region(writer);
+    
+    // üũ   
+    if (fseek(file, 0, SEEK_SET) != 0 || fwrite(&header, sizeof(header), 1, file) != 1) {
+        writer->failed = 1;
+    }
+    if (fclose(file) != 0) writer->failed = 1;
+    
+    ok = !writer->failed;
+    free(writer);
+    free(id_table);
+    free(subjects.index);
+    free(subjects.ids);
+    
+    // ϼ ӽ Ϸ ü (Windows rename   ϹǷ  )
+    //  ε      ִ    ״ 
+    if (ok) {
+        remove(filename);
+        ok = rename(temp_name, filename) == 0;
+    }
+    if (!ok) {
+        fprintf(stderr, ":  '%s'   ϴ.\n", filename);
+        remove(temp_name);
+        return 0;
+    }
+    
+    printf(" '%s' Ǿϴ. ( %d)\n", filename, manager->count);
+    return 1;
+}
+
+//     ùٸ ˻ - ùٸ 1, ƴϸ    0 ȯ
+//   ȣ, ġ, й ε    ȮϹǷ Ŀ  ˻    
+// ݵ  ũ ̸   Ȯ (üũ ະ ġ ϰ ε validate_snapshot_cold,
+//  ε check_snapshot_record  ó ä   ุ ˻)
+static int validate_snapshot(const char *filename, const char *data, size_t size,
+                             SnapshotHeader *header, SnapshotLayout *layout) {
+    if (size < sizeof(SnapshotHeader)) {
+        fprintf(stderr, ":  '%s'  ߸Ǿϴ.\n", filename);
+        return 0;
+    }
+    memcpy(header, data, sizeof(SnapshotHeader));
+    if (memcmp(header->magic, SNAPSHOT_MAGIC, sizeof(header->magic)) != 0 ||
+        header->header_size != sizeof(SnapshotHeader)) {
+        fprintf(stderr, ":  '%s'  ߸Ǿϴ.\n", filename);
+        return 0;
+    }
+    if (header->version != SNAPSHOT_VERSION) {
+        fprintf(stderr, ":  ʴ  Դϴ. (%u)\n", (unsigned)header->version);
+        return 0;
+    }
+    
+    snapshot_layout(header, data, layout);
+    uint32_t n = header->record_count;
+    uint32_t table_size = header->id_table_size;
+    if (layout->size != (uint64_t)size || n > (uint32_t)INT32_MAX ||
+        table_size == 0 || (table_size & (table_size - 1)) != 0 || table_size / 2 < n) {
+        fprintf(stderr, ":  '%s'  ߸Ǿϴ.\n", filename);
+        return 0;
+    }
+    
+    if (checksum_bytes(data + sizeof(SnapshotHeader), layout->hot_size) != header->hot_checksum) {
+        fprintf(stderr, ":  '%s' üũ  ʽϴ.\n", filename);
+        return 0;
+    }
+    
+    //   0̸    ġ о ڿ  ȿ 
+    int valid = (header->dict_size == 0 || layout->dict[header->dict_size - 1] == '\0') &&
+                (header->heap_size == 0 || layout->heap[header->heap_size - 1] == '\0') &&
+                layout->grade_begin[0] == 0 && layout->grade_begin[n] == header->grade_count;
+    for (uint32_t i = 0; valid && i < n; i++) {
+        valid = layout->major[i] < header->major_count &&
+                layout->grade_begin[i] <= layout->grade_begin[i + 1];
+    }
+    for (uint32_t i = 0; valid && i < header->subject_count; i++) {
+        valid = layout->subject_name[i] < header->dict_size;
+    }
+    for (uint32_t i = 0; valid && i < header->major_count; i++) {
+        valid = layout->major_name[i] < header->dict_size;
+    }
+    
+    // й ε   ȣ̰ ä ĭ л  Ͽ Ž  ĭ 
+    uint32_t filled = 0;
+    for (uint32_t i = 0; valid && i < table_size; i++) {
+        int32_t row = layout->id_table[i];
+        if (row == -1) continue;
+        valid = row >= 0 && (uint32_t)row < n && ++filled <= n;
+    }
+    if (!valid) {
+        fprintf(stderr, ":  '%s'  ߸Ǿϴ.\n", filename);
+        return 0;
+    }
+    return 1;
+}
+
+// ݵ  ü ˻ (ϰ ε) - üũ ึ ̸ ġ,   ȣ   Ȯ
+// ϰ ε    Ƿ ջ  ڵ带   ° ź
+static int validate_snapshot_cold(const char *filename, const char *data,
+                                  const SnapshotHeader *header, const SnapshotLayout *layout) {
+    const char *cold = data + sizeof(SnapshotHeader) + layout->hot_size;
+    if (checksum_bytes(cold, layout->size - sizeof(SnapshotHeader) - layout->hot_size) != header->checksum) {
+        fprintf(stderr, ":  '%s' üũ  ʽϴ.\n", filename);
+        return 0;
+    }
+    
+    int valid = 1;
+    for (uint32_t i = 0; valid && i < header->record_count; i++) {
+        valid = layout->name[i] < header->heap_size;
+    }
+    for (uint32_t i = 0; valid && i < header->grade_count; i++) {
+        valid = layout->grades[i].subject < header->subject_count;
+    }
+    if (!valid) {
+        fprintf(stderr, ":  '%s'  ߸Ǿϴ.\n", filename);
+        return 0;
+    }
+    return 1;
+}
+
+//   ȣ ->   ID ǥ  - ޸   NULL ȯ
+static int* map_snapshot_subjects(const SnapshotHeader *header, const SnapshotLayout *layout) {
+    int *subject_map = (int*)malloc(sizeof(int) * (header->subject_count + 1));
+    if (!subject_map) {
+        fprintf(stderr, "޸ Ҵ :   ǥ\n");
+        return NULL;
+    }
+    for (uint32_t i = 0; i < header->subject_count; i++) {
+        subject_map[i] = intern_subject(layout->dict + layout->subject_name[i]);
+        if (subject_map[i] == -1) {
+            fprintf(stderr, "޸ Ҵ :   ǥ\n");
+            free(subject_map);
+            return NULL;
+        }
+    }
+    return subject_map;
+}
+
+//  row° л ݵ  ˻ ( ε尡   ó ä ) - ùٸ 1, ƴϸ    0 ȯ
+// ̸ ġ  ȣ    Ȯ   ࿡ ٽ  üũ    
+static int check_snapshot_record(const SnapshotHeader *header, const SnapshotLayout *layout, int row) {
+    uint32_t begin = layout->grade_begin[row];
+    uint32_t grade_count = layout->grade_begin[row + 1] - begin;
+    
+    int valid = layout->name[row] < header->heap_size;
+    uint64_t h = RECORD_CHECKSUM_SEED;
+    for (uint32_t g = 0; valid && g < grade_count; g++) {
+        valid = layout->grades[begin + g].subject < header->subject_count;
+        h = mix_snapshot_grade(h, &layout->grades[begin + g]);
+    }
+    if (!valid || snapshot_record_checksum(h, layout->weighted_sum[row], layout->total_credits[row],
+                                           layout->name[row], layout->heap + layout->name[row],
+                                           layout->reg_date + (size_t)row * SNAPSHOT_DATE_LEN) !=
+                  layout->record_check[row]) {
+        fprintf(stderr, ":  й %d  ջǾϴ.\n", layout->id[row]);
+        return 0;
+    }
+    return 1;
+}
+
+//  row° л ڵ忡 ä -   1,   0 ȯ
+//   ȣڰ ̸ ˻ؾ  (ϰ ε validate_snapshot_cold,  ε check_snapshot_record)
+//  迭 reserve Ȯϸ, Ȯ ϸ ڵ  ٲ ʰ 
+static int read_snapshot_record(const SnapshotLayout *layout, const int *subject_map,
+                                int row, StudentRecord *record,
+                                int (*reserve)(StudentRecord*, int)) {
+    uint32_t begin = layout->grade_begin[row];
+    int subject_count = (int)(layout->grade_begin[row + 1] - begin);
+    if (!reserve(record, subject_count)) return 0;
+    
+    const char *name = layout->heap + layout->name[row];
+    copy_span(record->info.name, MAX_NAME_LEN, name, name + strlen(name));
+    const char *major = layout->dict + layout->major_name[layout->major[row]];
+    copy_span(record->info.major, MAX_MAJOR_LEN, major, major + strlen(major));
+    const char *date = layout->reg_date + (size_t)row * SNAPSHOT_DATE_LEN;
+    const char *date_end = (const char*)memchr(date, '\0', SNAPSHOT_DATE_LEN);
+    copy_span(record->info.reg_date, sizeof(record->info.reg_date), date,
+              date_end ? date_end : date + SNAPSHOT_DATE_LEN);
+    record->info.id = layout->id[row];
+    for (int g = 0; g < subject_count; g++) {
+        const SnapshotGrade *grade = &layout->grades[begin + g];
+        record->grades[g].subject_id = subject_map[grade->subject];
+        record->grades[g].score = grade->score;
+        record->grades[g].credit = grade->credit;
+        record->grades[g].grade = (char)grade->grade;
+    }
+    record->subject_count = subject_count;
+    record->weighted_sum = layout->weighted_sum[row];
+    record->total_credits = layout->total_credits[row];
+    record->gpa = layout->gpa[row];
+    return 1;
+}
+
+//    ε ( ʹ ) -   1,   0 ȯ
+// , GPA,  հ谡 Ǿ Ƿ ؽƮ Ľ̰ GPA   ڵ带 ٷ ä
+int load_snapshot(StudentManager *manager, const char *filename) {
+    CsvFile file;
+    if (!open_csv_file(filename, &file)) {
+        fprintf(stderr, ":  '%s'   ϴ.\n", filename);
+        return 0;
+    }
+    
+    SnapshotHeader header;
+    SnapshotLayout layout;
+    if (!validate_snapshot(filename, file.data, file.size, &header, &layout) ||
+        !validate_snapshot_cold(filename, file.data, &header, &layout)) {
+        close_csv_file(&file);
+        return 0;
+    }
+    int count = (int)header.record_count;
+    
+    int *subject_map = map_snapshot_subjects(&header, &layout);
+    if (!subject_map) {
+        close_csv_file(&file);
+        return 0;
+    }
+    
+    clear_students(manager);
+    if (!reserve_students(manager, count)) {
+        free(subject_map);
+        close_csv_file(&file);
+        return 0;
+    }
+    
+    StudentRecord record;
+    init_parse_record(&record);
+    int loaded_count = 0;
+    for (int i = 0; i < count; i++) {
+        if (!read_snapshot_record(&layout, subject_map, i, &record, reserve_grades) ||
+            !append_student_record(manager, &record)) {
+            fprintf(stderr, ": й %d   ߽ϴ.\n", layout.id[i]);
+            continue;
+        }
+        loaded_count++;
+    }
+    
+    release_grades(&record);
+    free(subject_map);
+    close_csv_file(&file);
+    printf("Ͱ  '%s' εǾϴ. ( %d)\n", filename, loaded_count);
+    return 1;
+}
+
+//  ε   - ڰ ڵ带 ó   ο ä
+typedef struct {
+    CsvFile file;
+    SnapshotHeader header;
+    SnapshotLayout layout;
+    int *subject_map;            //   ȣ ->   ID
+} LazySnapshot;
+
+//  ڵ ϳ ä (RecordSource.load) -  ุ ˻  ä
+static int load_lazy_snapshot_record(StudentRecord *record, int row, void *context) {
+    const LazySnapshot *snapshot = (const LazySnapshot*)context;
+    return check_snapshot_record(&snapshot->header, &snapshot->layout, row) &&
+           read_snapshot_record(&snapshot->layout, snapshot->subject_map,
+                                row, record, reserve_loaded_grades);
+}
+
+//  ε   (RecordSource.release)
+static void release_lazy_snapshot(void *context) {
+    LazySnapshot *snapshot = (LazySnapshot*)context;
+    close_csv_file(&snapshot->file);
+    free(snapshot->subject_map);
+    free(snapshot);
+}
+
+//  ε  ݵ  ȸ л κи  Ƿ ̸ б⸦  ( )
+//  ˻纸  ҷ ݵ  ù ٺ ǰ  (  Ʋ   ǵ帮 )
+#if defined(POSIX_MADV_RANDOM)
+static void advise_snapshot_cold(const CsvFile *file) {
+    long page = sysconf(_SC_PAGESIZE);
+    if (!file->mapped || page <= 0 || file->size < sizeof(SnapshotHeader)) return;
+    
+    SnapshotHeader header;
+    SnapshotLayout layout;
+    memcpy(&header, file->data, sizeof(header));
+    snapshot_layout(&header, NULL, &layout);
+    uint64_t cold = ((sizeof(SnapshotHeader) + layout.hot_size + (uint64_t)page - 1) /
+                     (uint64_t)page) * (uint64_t)page;
+    if (cold < (uint64_t)file->size) {
+        posix_madvise((void*)(file->data + cold), file->size - (size_t)cold, POSIX_MADV_RANDOM);
+    }
+}
+#endif
+
+//    ε ( ʹ ) -   1,   0 ȯ
+//    (й ε, й, GPA, ,  ,  üũ) а ˻ϸ, ̸// 
+// ڵ忡 ó   ο  ุ ˻ äǷ  ޸𸮰  ȸ л  
+//  clear_students destroy_manager   (ջ  materialize_record   ڵ )
+int load_snapshot_lazy(StudentManager *manager, const char *filename) {
+    LazySnapshot *snapshot = (LazySnapshot*)malloc(sizeof(LazySnapshot));
+    if (!snapshot) {
+        fprintf(stderr, "޸ Ҵ : \n");
+        return 0;
+    }
+    snapshot->subject_map = NULL;
+    if (!open_csv_file(filename, &snapshot->file)) {
+        fprintf(stderr, ":  '%s'   ϴ.\n", filename);
+        free(snapshot);
+        return 0;
+    }
+    
+#if defined(POSIX_MADV_RANDOM)
+    advise_snapshot_cold(&snapshot->file);
+#endif
+    
+    const SnapshotLayout *layout = &snapshot->layout;
+    int *major_map = NULL;
+    if (!validate_snapshot(filename, snapshot->file.data, snapshot->file.size,
+                           &snapshot->header, &snapshot->layout) ||
+        !(snapshot->subject_map = map_snapshot_subjects(&snapshot->header, layout)) ||
+        !(major_map = (int*)malloc(sizeof(int) * (snapshot->header.major_count + 1)))) {
+        release_lazy_snapshot(snapshot);
+        return 0;
+    }
+    int count = (int)snapshot->header.record_count;
+    
+    RecordSource source;
+    source.load = load_lazy_snapshot_record;
+    source.release = release_lazy_snapshot;
+    source.context = snapshot;
+    if (!begin_lazy_records(manager, count, &source)) {
+        free(major_map);
+        release_lazy_snapshot(snapshot);
+        return 0;
+    }
+    
+    //  ÷ й ε ο ٷ ä ( ȣ =  ȣ)
+    for (uint32_t i = 0; i < snapshot->header.major_count; i++) {
+        major_map[i] = intern_string(&manager->majors, layout->dict + layout->major_name[i]);
+        if (major_map[i] == -1) {
+            free(major_map);
+            clear_students(manager);
+            return 0;
+        }
+    }
+    HotColumns *hot = &manager->hot;
+    for (int i = 0; i < count; i++) {
+        hot->id[i] = layout->id[i];
+        hot->gpa[i] = layout->gpa[i];
+        hot->subject_count[i] = (int)(layout->grade_begin[i + 1] - layout->grade_begin[i]);
+        hot->major_id[i] = major_map[layout->major[i]];
+    }
+    adopt_id_index(manager, layout->id_table, (int)snapshot->header.id_table_size);
+    rebuild_class_aggregates(manager);
+    free(major_map);
+    
+    printf("Ͱ  '%s' εǾϴ. ( %d)\n", filename, count);
     return 1;
 }
+
+//  CSV  ᵵ Ǵ Ȯ -  ְ CSV ų CSV  ʾ 1
+int is_snapshot_current(const char *snapshot_file, const char *csv_file) {
+    struct stat snapshot_info, csv_info;
+    if (stat(snapshot_file, &snapshot_info) != 0) return 0;
+    if (stat(csv_file, &csv_info) != 0) return 1;
+    return snapshot_info.st_mtime >= csv_info.st_mtime;
+}
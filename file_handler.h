@@ -10,15 +10,32 @@
 // ⺻ ϸ
 #define DEFAULT_DATA_FILE "students.csv"
 #define BACKUP_FILE "students_backup.csv"
+#define DEFAULT_SNAPSHOT_FILE "students.snap"
 
 // CSV 
 #define CSV_DELIMITER ","
 #define GRADE_DELIMITER ";"
+#define CSV_BLOCK 64             //  ġ   ã  ũ (Ʈ)
+#define CSV_MAX_FIELDS 8         // ڵ忡 ϴ ִ ʵ 
+#define INGEST_UNIT 128          //  ε ۾  (Ʈ, 뷫   ũ)
+#define INGEST_CHUNK_UNITS 32768 //  ε  ûũ   (4MB)
+
+//   
+#define SNAPSHOT_MAGIC "SMSSNAP"   //    8Ʈ ( 0 )
+#define SNAPSHOT_VERSION 3         //  ٲ ø (ٸ   )
+#define SNAPSHOT_DATE_LEN 11       //    (Student.reg_date )
+#define SNAPSHOT_BUFFER 65536      //    ũ (32Ʈ )
 
 //  /ε Լ
 int save_data(const StudentManager *manager, const char *filename);
 int load_data(StudentManager *manager, const char *filename);
 
+//   /ε Լ (CSV  ۿ)
+int save_snapshot(const StudentManager *manager, const char *filename);
+int load_snapshot(StudentManager *manager, const char *filename);
+int load_snapshot_lazy(StudentManager *manager, const char *filename);
+int is_snapshot_current(const char *snapshot_file, const char *csv_file);
+
 //   Լ
 int create_backup(const char *source_file);
 int restore_from_backup(StudentManager *manager);
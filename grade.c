@@ -1,4 +1,685 @@
 #include "grade.h"
+#include "thread_pool.h"
+#include <limits.h>
+
+// ϰ GPA  Ŀο SIMD (AVX2 > SSE2 > Į  )
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+//    -  ⿡   ǰ   ID 
+static StringDict subject_dictionary;
+
+//   -  ID ȯ (̹   ID, ޸   -1)
+//   Grade ü  MAX_NAME_LEN - 1 Ʈ 
+int intern_subject(const char *subject) {
+    char name[MAX_NAME_LEN];
+    strncpy(name, subject, MAX_NAME_LEN - 1);
+    name[MAX_NAME_LEN - 1] = '\0';
+    return intern_string(&subject_dictionary, name);
+}
+
+//   ID ȸ -   ϵ   ̸ -1
+int find_subject_id(const char *subject) {
+    char name[MAX_NAME_LEN];
+    strncpy(name, subject, MAX_NAME_LEN - 1);
+    name[MAX_NAME_LEN - 1] = '\0';
+    return find_string(&subject_dictionary, name);
+}
+
+//  ID  ȸ
+const char* get_subject_name(int subject_id) {
+    return get_string(&subject_dictionary, subject_id);
+}
+
+//   ޸  (α׷  )
+void destroy_subject_dictionary(void) {
+    destroy_dictionary(&subject_dictionary);
+}
+
+//  ID  ġ ã -  -1 ȯ ( 񱳸 )
+int find_grade_index(const StudentRecord *record, int subject_id) {
+    if (subject_id < 0) return -1;
+    for (int i = 0; i < record->subject_count; i++) {
+        if (record->grades[i].subject_id == subject_id) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+//   ũ  -> ĭ 
+static int run_class_size(int run_class) {
+    return GRADE_RUN_MIN << run_class;
+}
+
+// cells ĭ   ִ   ũ  -   -1
+static int run_class_for(int cells) {
+    int run_class = 0;
+    while (run_class < GRADE_RUN_CLASSES && run_class_size(run_class) < cells) {
+        run_class++;
+    }
+    return (run_class < GRADE_RUN_CLASSES) ? run_class : -1;
+}
+
+//  Ʒ ʱȭ
+void init_grade_arena(GradeArena *arena) {
+    arena->blocks = NULL;
+    arena->block_count = 0;
+    arena->block_slots = 0;
+    arena->current = NULL;
+    arena->current_used = 0;
+    arena->current_size = 0;
+    for (int k = 0; k < GRADE_RUN_CLASSES; k++) {
+        arena->free_runs[k] = NULL;
+    }
+    arena->used_cells = 0;
+    arena->free_cells = 0;
+}
+
+//  Ʒ ޸  ( Ʒ ǵ)
+void destroy_grade_arena(GradeArena *arena) {
+    for (int i = 0; i < arena->block_count; i++) {
+        free(arena->blocks[i]);
+    }
+    free(arena->blocks);
+    init_grade_arena(arena);
+}
+
+// ݳ  ũ ޺  Ͽ  ( ù ĭ    )
+static void push_free_run(GradeArena *arena, Grade *run, int run_class) {
+    memcpy(run, &arena->free_runs[run_class], sizeof(Grade*));
+    arena->free_runs[run_class] = run;
+    arena->free_cells += run_class_size(run_class);
+}
+
+//   Ҵ   Ͽ  -   NULL ȯ
+static Grade* arena_new_block(GradeArena *arena, int size) {
+    if (arena->block_count == arena->block_slots) {
+        int new_slots = arena->block_slots > 0 ? arena->block_slots * 2 : 8;
+        Grade **new_blocks = (Grade**)realloc(arena->blocks, sizeof(Grade*) * new_slots);
+        if (!new_blocks) return NULL;
+        arena->blocks = new_blocks;
+        arena->block_slots = new_slots;
+    }
+    
+    Grade *block = (Grade*)malloc(sizeof(Grade) * size);
+    if (!block) return NULL;
+    arena->blocks[arena->block_count++] = block;
+    return block;
+}
+
+//    ĭ   ѱ (  ٲٱ  ȣ)
+static void retire_current_block(GradeArena *arena) {
+    while (arena->current && arena->current_size - arena->current_used >= GRADE_RUN_MIN) {
+        int remaining = arena->current_size - arena->current_used;
+        int run_class = GRADE_RUN_CLASSES - 1;
+        while (run_class_size(run_class) > remaining) run_class--;
+        
+        push_free_run(arena, arena->current + arena->current_used, run_class);
+        arena->current_used += run_class_size(run_class);
+    }
+}
+
+// ũ ޿ ´   -    ,   Ͽ ߶ 
+static Grade* arena_alloc(GradeArena *arena, int run_class) {
+    int size = run_class_size(run_class);
+    Grade *run = arena->free_runs[run_class];
+    
+    if (run) {
+        memcpy(&arena->free_runs[run_class], run, sizeof(Grade*));
+        arena->free_cells -= size;
+    } else if (size > GRADE_BLOCK_SIZE) {
+        // Ϻ ū   Ͽ ġ
+        run = arena_new_block(arena, size);
+        if (!run) return NULL;
+    } else {
+        if (!arena->current || arena->current_size - arena->current_used < size) {
+            retire_current_block(arena);
+            Grade *block = arena_new_block(arena, GRADE_BLOCK_SIZE);
+            if (!block) return NULL;
+            arena->current = block;
+            arena->current_used = 0;
+            arena->current_size = GRADE_BLOCK_SIZE;
+        }
+        run = arena->current + arena->current_used;
+        arena->current_used += size;
+    }
+    
+    arena->used_cells += size;
+    return run;
+}
+
+//  Ʒ ݳ
+static void arena_free(GradeArena *arena, Grade *run, int capacity) {
+    push_free_run(arena, run, run_class_for(capacity));
+    arena->used_cells -= capacity;
+}
+
+//   ĭ   ĭ  Ʒ 
+static void maybe_compact_grade_arena(StudentManager *manager) {
+    const GradeArena *arena = &manager->grade_arena;
+    if (arena->free_cells >= GRADE_BLOCK_SIZE && arena->free_cells > arena->used_cells) {
+        compact_grade_arena(manager);
+    }
+}
+
+//  迭 capacity ĭ ̻ Ȯ (Ʒ  ȣڰ ) -   1,   0 ȯ
+static int grow_grades(StudentRecord *record, int capacity) {
+    if (capacity <= record->grade_capacity) return 1;
+    
+    int run_class = run_class_for(capacity);
+    if (run_class == -1) {
+        fprintf(stderr, ":   ʹ ϴ.\n");
+        return 0;
+    }
+    
+    Grade *run;
+    if (!record->owner) {
+        run = (Grade*)realloc(record->grades, sizeof(Grade) * run_class_size(run_class));
+    } else {
+        GradeArena *arena = &record->owner->grade_arena;
+        run = arena_alloc(arena, run_class);
+        if (run && record->grade_capacity > 0) {
+            memcpy(run, record->grades, sizeof(Grade) * record->subject_count);
+            arena_free(arena, record->grades, record->grade_capacity);
+        }
+    }
+    
+    if (!run) {
+        fprintf(stderr, "޸ Ҵ :  迭\n");
+        return 0;
+    }
+    
+    record->grades = run;
+    record->grade_capacity = run_class_size(run_class);
+    return 1;
+}
+
+// ڵ  迭 capacity ĭ ̻ Ȯ -   1,   0 ȯ
+//  Ҽ ڵ Ʒ  ū  ű,   ڵ realloc 
+int reserve_grades(StudentRecord *record, int capacity) {
+    if (capacity <= record->grade_capacity) return 1;
+    if (!grow_grades(record, capacity)) return 0;
+    
+    if (record->owner) {
+        maybe_compact_grade_arena(record->owner);
+    }
+    return 1;
+}
+
+//  ڵ带 ä   迭 Ȯ -   1,   0 ȯ
+// ٸ 尡 ٸ ڵ  д   Ƿ Ʒ   
+int reserve_loaded_grades(StudentRecord *record, int capacity) {
+    return grow_grades(record, capacity);
+}
+
+// ڵ  迭 ݳ (  0 ʱȭ)
+void release_grades(StudentRecord *record) {
+    if (record->grade_capacity > 0) {
+        if (!record->owner) {
+            free(record->grades);
+        } else {
+            arena_free(&record->owner->grade_arena, record->grades, record->grade_capacity);
+        }
+    }
+    
+    record->grades = NULL;
+    record->grade_capacity = 0;
+    record->subject_count = 0;
+    record->weighted_sum = 0.0;
+    record->total_credits = 0;
+    
+    if (record->owner) {
+        maybe_compact_grade_arena(record->owner);
+    }
+}
+
+//    ϸ   ϳ       ȸ
+//   1, ޸   0 ȯ (ص  Ʒ ״ ȿ)
+//  ڵ grades ּҰ ٲǷ   Grade ʹ ٽ ؾ 
+int compact_grade_arena(StudentManager *manager) {
+    GradeArena fresh;
+    long total = 0;
+    
+    //  ä   ڵ   Ƿ ǳʶ
+    init_grade_arena(&fresh);
+    for (int i = 0; i < manager->slot_count; i++) {
+        if (manager->lazy_rows && is_record_pending(manager, i)) continue;
+        total += record_storage(manager, i)->grade_capacity;
+    }
+    
+    // ʿ ĭ  ϳ   Ҵϰ, ũ     Ͽ ʷ ߶ 
+    // (arena_alloc Ϻ ū Ͽ    ҴϹǷ ⼭  )
+    if (total > 0) {
+        if (total > INT_MAX / (long)sizeof(Grade)) return 0;
+        fresh.current = arena_new_block(&fresh, (int)total);
+        if (!fresh.current) {
+            destroy_grade_arena(&fresh);
+            return 0;
+        }
+        fresh.current_size = (int)total;
+    }
+    
+    for (int i = 0; i < manager->slot_count; i++) {
+        if (manager->lazy_rows && is_record_pending(manager, i)) continue;
+        StudentRecord *record = record_storage(manager, i);
+        if (record->grade_capacity == 0) continue;
+        
+        Grade *run = fresh.current + fresh.current_used;
+        fresh.current_used += record->grade_capacity;
+        fresh.used_cells += record->grade_capacity;
+        memcpy(run, record->grades, sizeof(Grade) * record->subject_count);
+        record->grades = run;
+    }
+    
+    destroy_grade_arena(&manager->grade_arena);
+    manager->grade_arena = fresh;
+    return 1;
+}
+
+//   ʱȭ
+void init_subject_index(SubjectIndex *index) {
+    index->lists = NULL;
+    index->list_count = 0;
+    index->stale = 0;
+}
+
+//   ޸  (  ǵ)
+void destroy_subject_index(SubjectIndex *index) {
+    for (int i = 0; i < index->list_count; i++) {
+        free(index->lists[i].items);
+        free(index->lists[i].sketch);
+    }
+    free(index->lists);
+    init_subject_index(index);
+}
+
+//  ID شϴ   Ȯ (  ũ⸸ŭ  迭 Ȯ) -   NULL
+static PostingList* posting_list_for(SubjectIndex *index, int subject_id) {
+    if (subject_id >= index->list_count) {
+        int new_count = index->list_count > 0 ? index->list_count : 16;
+        while (new_count <= subject_id) new_count *= 2;
+        
+        PostingList *lists = (PostingList*)realloc(index->lists, sizeof(PostingList) * new_count);
+        if (!lists) return NULL;
+        for (int i = index->list_count; i < new_count; i++) {
+            lists[i].items = NULL;
+            lists[i].count = 0;
+            lists[i].capacity = 0;
+            lists[i].sketch = NULL;
+        }
+        index->lists = lists;
+        index->list_count = new_count;
+    }
+    return &index->lists[subject_id];
+}
+
+//     ġ Ȯ (ó   ) -   NULL
+static QuantileSketch* posting_list_sketch(PostingList *list) {
+    if (!list->sketch) {
+        list->sketch = (QuantileSketch*)malloc(sizeof(QuantileSketch));
+        if (!list->sketch) return NULL;
+        init_quantile_sketch(list->sketch, SCORE_SKETCH_SCALE);
+    }
+    return list->sketch;
+}
+
+//   pos ġ ׸  (  ,   ) -   1,   0 ȯ
+static int posting_list_insert(PostingList *list, int pos, int slot, const Grade *grade) {
+    if (list->count == list->capacity) {
+        int new_capacity = list->capacity > 0 ? list->capacity * 2 : 4;
+        SubjectPosting *items = (SubjectPosting*)realloc(list->items, sizeof(SubjectPosting) * new_capacity);
+        if (!items) return 0;
+        list->items = items;
+        list->capacity = new_capacity;
+    }
+    
+    memmove(&list->items[pos + 1], &list->items[pos], sizeof(SubjectPosting) * (list->count - pos));
+    list->count++;
+    
+    SubjectPosting *posting = &list->items[pos];
+    posting->slot = slot;
+    posting->score = grade->score;
+    posting->grade = grade->grade;
+    return 1;
+}
+
+//  Ͽ  ̻ ù ׸ ġ (  ,  Ž)
+static int posting_list_lower_bound(const PostingList *list, int slot) {
+    int lo = 0;
+    int hi = list->count;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (list->items[mid].slot < slot) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+// ü ڵ   籸 ( ) -   1, ޸   0 ȯ
+int rebuild_subject_index(StudentManager *manager) {
+    SubjectIndex *index = &manager->subject_index;
+    for (int i = 0; i < index->list_count; i++) {
+        index->lists[i].count = 0;
+        if (index->lists[i].sketch) {
+            init_quantile_sketch(index->lists[i].sketch, SCORE_SKETCH_SCALE);
+        }
+    }
+    
+    for (int slot = 0; slot < manager->slot_count; slot++) {
+        const StudentRecord *record = get_record(manager, slot);
+        if (record->deleted) continue;
+        
+        for (int j = 0; j < record->subject_count; j++) {
+            const Grade *grade = &record->grades[j];
+            
+            // Ͽ      ù   (   )
+            if (find_grade_index(record, grade->subject_id) != j) continue;
+            
+            PostingList *list = posting_list_for(index, grade->subject_id);
+            QuantileSketch *sketch = list ? posting_list_sketch(list) : NULL;
+            if (!sketch || !posting_list_insert(list, list->count, slot, grade)) {
+                fprintf(stderr, "޸ Ҵ :  \n");
+                index->stale = 1;
+                return 0;
+            }
+            sketch_add(sketch, grade->score);
+        }
+    }
+    
+    index->stale = 0;
+    return 1;
+}
+
+//    ȸ (ʿϸ  籸) -  ų 籸   NULL
+//  ǥõ л(hot.live == 0) ׸    Ƿ ȣڰ ǳʶپ 
+const PostingList* get_subject_postings(const StudentManager *manager, int subject_id) {
+    //  籸 ϹǷ const ڿ ȣ 
+    StudentManager *cache = (StudentManager*)manager;
+    const SubjectIndex *index = &manager->subject_index;
+    
+    if (subject_id < 0) return NULL;
+    if (index->stale && !rebuild_subject_index(cache)) return NULL;
+    if (subject_id >= index->list_count || index->lists[subject_id].count == 0) return NULL;
+    return &index->lists[subject_id];
+}
+
+//    ġ ȸ (ʿϸ  籸) -   NULL
+const QuantileSketch* get_subject_sketch(const StudentManager *manager, int subject_id) {
+    const PostingList *list = get_subject_postings(manager, subject_id);
+    return list ? list->sketch : NULL;
+}
+
+//  Ҽ ڵ    ο ݿ (grade NULL̸ ׸ )
+static void update_subject_posting(StudentRecord *record, int subject_id, const Grade *grade) {
+    StudentManager *manager = record->owner;
+    if (!manager || manager->subject_index.stale) return;
+    
+    int slot = record_slot(record);
+    PostingList *list = posting_list_for(&manager->subject_index, subject_id);
+    QuantileSketch *sketch = list ? posting_list_sketch(list) : NULL;
+    if (slot == -1 || !sketch) {
+        manager->subject_index.stale = 1;
+        return;
+    }
+    
+    int pos = posting_list_lower_bound(list, slot);
+    int found = pos < list->count && list->items[pos].slot == slot;
+    if (!grade) {
+        //  ׸    
+        if (found) {
+            sketch_remove(sketch, list->items[pos].score);
+            list->count--;
+            memmove(&list->items[pos], &list->items[pos + 1],
+                    sizeof(SubjectPosting) * (list->count - pos));
+        }
+    } else if (found) {
+        sketch_remove(sketch, list->items[pos].score);
+        sketch_add(sketch, grade->score);
+        list->items[pos].score = grade->score;
+        list->items[pos].grade = grade->grade;
+    } else if (posting_list_insert(list, pos, slot, grade)) {
+        sketch_add(sketch, grade->score);
+    } else {
+        manager->subject_index.stale = 1;
+    }
+}
+
+// Ǵ л    ġ  ( ݳϱ  ȣ)
+//   ׸  ΰ ȸ  ǳʶ (  籸)
+void remove_subject_scores(StudentManager *manager, int slot) {
+    SubjectIndex *index = &manager->subject_index;
+    if (index->stale) return;
+    
+    const StudentRecord *record = get_record(manager, slot);
+    for (int j = 0; j < record->subject_count; j++) {
+        int subject_id = record->grades[j].subject_id;
+        if (subject_id >= index->list_count || !index->lists[subject_id].sketch) continue;
+        
+        // ο  ( ù )    ׸񿡼 
+        const PostingList *list = &index->lists[subject_id];
+        int pos = posting_list_lower_bound(list, slot);
+        if (find_grade_index(record, subject_id) == j && pos < list->count && list->items[pos].slot == slot) {
+            sketch_remove(list->sketch, list->items[pos].score);
+        }
+    }
+}
+
+//   -> Ʈ ȣ (A=0 ... F=4),    ̸ -1
+int grade_letter_index(char grade) {
+    switch (grade) {
+        case 'A': return 0;
+        case 'B': return 1;
+        case 'C': return 2;
+        case 'D': return 3;
+        case 'F': return 4;
+        default: return -1;
+    }
+}
+
+// Ʈ  ʱȭ
+void init_bitmap_index(BitmapIndex *index) {
+    for (int k = 0; k < GRADE_LETTER_COUNT; k++) {
+        init_bitmap(&index->letters[k]);
+    }
+    index->subject_letters = NULL;
+    index->subject_capacity = 0;
+    index->majors = NULL;
+    index->major_capacity = 0;
+    index->stale = 0;
+}
+
+// Ʈ  ޸  (  ǵ)
+void destroy_bitmap_index(BitmapIndex *index) {
+    for (int k = 0; k < GRADE_LETTER_COUNT; k++) {
+        destroy_bitmap(&index->letters[k]);
+    }
+    for (int i = 0; i < index->subject_capacity * GRADE_LETTER_COUNT; i++) {
+        destroy_bitmap(&index->subject_letters[i]);
+    }
+    for (int i = 0; i < index->major_capacity; i++) {
+        destroy_bitmap(&index->majors[i]);
+    }
+    free(index->subject_letters);
+    free(index->majors);
+    init_bitmap_index(index);
+}
+
+// Ʈ 迭 count ̻ Ȯ ( ĭ  Ʈ) -   1,   0 ȯ
+static int grow_bitmap_array(RoaringBitmap **bitmaps, int *capacity, int count) {
+    if (count <= *capacity) return 1;
+    
+    int new_capacity = *capacity > 0 ? *capacity : 16;
+    while (new_capacity < count) new_capacity *= 2;
+    
+    RoaringBitmap *grown = (RoaringBitmap*)realloc(*bitmaps, sizeof(RoaringBitmap) * new_capacity);
+    if (!grown) return 0;
+    for (int i = *capacity; i < new_capacity; i++) {
+        init_bitmap(&grown[i]);
+    }
+    *bitmaps = grown;
+    *capacity = new_capacity;
+    return 1;
+}
+
+// (, ) Ʈ Ȯ -   NULL
+static RoaringBitmap* subject_letter_bitmap(BitmapIndex *index, int subject_id, int letter) {
+    int capacity = index->subject_capacity * GRADE_LETTER_COUNT;
+    if (!grow_bitmap_array(&index->subject_letters, &capacity, (subject_id + 1) * GRADE_LETTER_COUNT)) {
+        return NULL;
+    }
+    index->subject_capacity = capacity / GRADE_LETTER_COUNT;
+    return &index->subject_letters[subject_id * GRADE_LETTER_COUNT + letter];
+}
+
+// л  ϳ /(, ) Ʈʿ ߰ -   1,   0 ȯ
+static int bitmap_index_add_grade(BitmapIndex *index, int slot, const Grade *grade) {
+    int letter = grade_letter_index(grade->grade);
+    if (letter == -1) return 1;
+    
+    RoaringBitmap *pair = subject_letter_bitmap(index, grade->subject_id, letter);
+    return pair && bitmap_add(pair, (unsigned int)slot) &&
+           bitmap_add(&index->letters[letter], (unsigned int)slot);
+}
+
+// ü ڵ  ÷ Ʈ  籸 -   1, ޸   0 ȯ
+int rebuild_bitmap_index(StudentManager *manager) {
+    BitmapIndex *index = &manager->bitmap_index;
+    destroy_bitmap_index(index);
+    
+    for (int slot = 0; slot < manager->slot_count; slot++) {
+        if (!manager->hot.live[slot]) continue;
+        
+        const StudentRecord *record = get_record(manager, slot);
+        int major_id = manager->hot.major_id[slot];
+        int ok = major_id < 0 ||
+                 (grow_bitmap_array(&index->majors, &index->major_capacity, major_id + 1) &&
+                  bitmap_add(&index->majors[major_id], (unsigned int)slot));
+        
+        for (int j = 0; ok && j < record->subject_count; j++) {
+            // Ͽ      ù   ( ΰ )
+            if (find_grade_index(record, record->grades[j].subject_id) != j) continue;
+            ok = bitmap_index_add_grade(index, slot, &record->grades[j]);
+        }
+        
+        if (!ok) {
+            fprintf(stderr, "޸ Ҵ : Ʈ \n");
+            index->stale = 1;
+            return 0;
+        }
+    }
+    
+    index->stale = 0;
+    return 1;
+}
+
+// л    Ʈʿ ݿ (old_major_id -1̸  л)
+void update_major_bitmap(StudentManager *manager, int slot, int old_major_id, int new_major_id) {
+    BitmapIndex *index = &manager->bitmap_index;
+    if (index->stale) return;
+    
+    if (old_major_id >= 0 && old_major_id < index->major_capacity) {
+        bitmap_remove(&index->majors[old_major_id], (unsigned int)slot);
+    }
+    if (new_major_id >= 0 &&
+        (!grow_bitmap_array(&index->majors, &index->major_capacity, new_major_id + 1) ||
+         !bitmap_add(&index->majors[new_major_id], (unsigned int)slot))) {
+        index->stale = 1;
+    }
+}
+
+// ڵ忡 ش    ִ Ȯ
+static int record_has_letter(const StudentRecord *record, char grade) {
+    for (int i = 0; i < record->subject_count; i++) {
+        if (record->grades[i].grade == grade) return 1;
+    }
+    return 0;
+}
+
+//  Ҽ ڵ   Ʈ ο ݿ ( 迭 ٲ  ȣ)
+// old_grade 0̸  , new_grade 0̸  
+static void update_grade_bitmaps(StudentRecord *record, int subject_id, char old_grade, char new_grade) {
+    StudentManager *manager = record->owner;
+    if (!manager || manager->bitmap_index.stale || old_grade == new_grade) return;
+    
+    BitmapIndex *index = &manager->bitmap_index;
+    int slot = record_slot(record);
+    if (slot == -1) {
+        index->stale = 1;
+        return;
+    }
+    
+    int old_letter = grade_letter_index(old_grade);
+    if (old_letter != -1) {
+        RoaringBitmap *pair = subject_letter_bitmap(index, subject_id, old_letter);
+        if (pair) bitmap_remove(pair, (unsigned int)slot);
+        if (!record_has_letter(record, old_grade)) {
+            bitmap_remove(&index->letters[old_letter], (unsigned int)slot);
+        }
+    }
+    
+    if (new_grade) {
+        Grade grade;
+        grade.subject_id = subject_id;
+        grade.grade = new_grade;
+        if (!bitmap_index_add_grade(index, slot, &grade)) {
+            index->stale = 1;
+        }
+    }
+}
+
+//    ڵ忡      (CSV   ߺ ) ϳ  
+//    ( ù ) - Ʈ ǻ츲
+static void restore_duplicate_subject(StudentRecord *record, int subject_id) {
+    int remaining = find_grade_index(record, subject_id);
+    if (remaining == -1) return;
+    
+    update_subject_posting(record, subject_id, &record->grades[remaining]);
+    
+    StudentManager *manager = record->owner;
+    if (!manager || manager->bitmap_index.stale) return;
+    int slot = record_slot(record);
+    for (int i = remaining; slot != -1 && i < record->subject_count; i++) {
+        if (record->grades[i].subject_id != subject_id) continue;
+        if (!bitmap_index_add_grade(&manager->bitmap_index, slot, &record->grades[i])) {
+            manager->bitmap_index.stale = 1;
+            return;
+        }
+    }
+    if (slot == -1) manager->bitmap_index.stale = 1;
+}
+
+//  Ʈ ȸ (ʿϸ  籸) - subject_id -1̸  
+// ش л ų 籸   NULL,  ǥõ л Ʈ ȣڰ ǳʶپ 
+const RoaringBitmap* get_letter_bitmap(const StudentManager *manager, int subject_id, char grade) {
+    //  籸 ϹǷ const ڿ ȣ 
+    StudentManager *cache = (StudentManager*)manager;
+    const BitmapIndex *index = &manager->bitmap_index;
+    int letter = grade_letter_index(grade);
+    
+    if (letter == -1) return NULL;
+    if (index->stale && !rebuild_bitmap_index(cache)) return NULL;
+    if (subject_id < 0) return &index->letters[letter];
+    if (subject_id >= index->subject_capacity) return NULL;
+    return &index->subject_letters[subject_id * GRADE_LETTER_COUNT + letter];
+}
+
+//  Ʈ ȸ (ʿϸ  籸) - ش  л  NULL
+const RoaringBitmap* get_major_bitmap(const StudentManager *manager, int major_id) {
+    StudentManager *cache = (StudentManager*)manager;
+    const BitmapIndex *index = &manager->bitmap_index;
+    
+    if (major_id < 0) return NULL;
+    if (index->stale && !rebuild_bitmap_index(cache)) return NULL;
+    if (major_id >= index->major_capacity) return NULL;
+    return &index->majors[major_id];
+}
 
 //  ȿ ˻ - 0.0 ~ 100.0  Ȯ
 int is_valid_score(float score) {
@@ -12,32 +693,31 @@ int is_valid_credit(int credit) {
 
 //  ߺ ˻ - ̹ ϵ ̸ 1, ƴϸ 0 ȯ
 int has_subject(const StudentRecord *record, const char *subject) {
-    for (int i = 0; i < record->subject_count; i++) {
-        if (strcmp(record->grades[i].subject, subject) == 0) {
-            return 1;
-        }
-    }
-    return 0;
+    return find_grade_index(record, find_subject_id(subject)) != -1;
 }
 
 //   ȯ (A, B, C, D, F)
+// б        (  ϰų NaN̸ F)
 char score_to_grade(float score) {
-    if (score >= 90.0) return 'A';
-    else if (score >= 80.0) return 'B';
-    else if (score >= 70.0) return 'C';
-    else if (score >= 60.0) return 'D';
-    else return 'F';
+    static const char letters[] = "FDCBA";
+    int passed = (score >= 90.0f) + (score >= 80.0f) + (score >= 70.0f) + (score >= 60.0f);
+    return letters[passed];
+}
+
+//  հ( x  ,  ) GPA  -    O(1)
+static float gpa_from_totals(const StudentRecord *record) {
+    if (record->subject_count == 0 || record->total_credits == 0) {
+        return 0.0;
+    }
+    
+    // 0~100  GPA 0~4.5  ȯ
+    float gpa_100 = (float)(record->weighted_sum / record->total_credits);
+    return gpa_100 * 0.045;
 }
 
 //   ߰ -   1,   0 ȯ
 int add_grade(StudentRecord *record, const char *subject, 
               float score, int credit) {
-    // ִ   ʰ ˻
-    if (record->subject_count >= MAX_SUBJECTS) {
-        fprintf(stderr, ": ִ  (%d) ʰ߽ϴ.\n", MAX_SUBJECTS);
-        return 0;
-    }
-    
     //  ȿ ˻
     if (!is_valid_score(score)) {
         fprintf(stderr, ": ȿ  Դϴ. (0.0 ~ 100.0)\n");
@@ -56,18 +736,28 @@ int add_grade(StudentRecord *record, const char *subject,
         return 0;
     }
     
+    //   ϰ  迭  Ȯ (   )
+    int subject_id = intern_subject(subject);
+    if (subject_id == -1 || !reserve_grades(record, record->subject_count + 1)) {
+        return 0;
+    }
+    
     //   ߰
     Grade *new_grade = &record->grades[record->subject_count];
-    strncpy(new_grade->subject, subject, MAX_NAME_LEN - 1);
-    new_grade->subject[MAX_NAME_LEN - 1] = '\0';
+    new_grade->subject_id = subject_id;
     new_grade->score = score;
     new_grade->credit = credit;
     new_grade->grade = score_to_grade(score);
     
     record->subject_count++;
+    update_subject_posting(record, subject_id, new_grade);
+    update_grade_bitmaps(record, subject_id, 0, new_grade->grade);
     
-    // GPA 
-    record->gpa = calculate_gpa(record);
+    //  հ迡    GPA  (ü  )
+    record->weighted_sum += (double)score * credit;
+    record->total_credits += credit;
+    record->gpa = gpa_from_totals(record);
+    notify_grades_changed(record);
     
     return 1;
 }
@@ -81,35 +771,33 @@ int update_grade(StudentRecord *record, const char *subject, float new_score) {
     }
     
     //  ã
-    for (int i = 0; i < record->subject_count; i++) {
-        if (strcmp(record->grades[i].subject, subject) == 0) {
-            //  
-            record->grades[i].score = new_score;
-            record->grades[i].grade = score_to_grade(new_score);
-            
-            // GPA 
-            record->gpa = calculate_gpa(record);
-            
-            return 1;
-        }
-    }
+    int i = find_grade_index(record, find_subject_id(subject));
     
     //  ã  
-    fprintf(stderr, ":  '%s'() ã  ϴ.\n", subject);
-    return 0;
+    if (i == -1) {
+        fprintf(stderr, ":  '%s'() ã  ϴ.\n", subject);
+        return 0;
+    }
+    
+    //  հ迡  ̸ ݿ   
+    char old_grade = record->grades[i].grade;
+    record->weighted_sum += ((double)new_score - record->grades[i].score) * record->grades[i].credit;
+    record->grades[i].score = new_score;
+    record->grades[i].grade = score_to_grade(new_score);
+    update_subject_posting(record, record->grades[i].subject_id, &record->grades[i]);
+    update_grade_bitmaps(record, record->grades[i].subject_id, old_grade, record->grades[i].grade);
+    
+    // GPA 
+    record->gpa = gpa_from_totals(record);
+    notify_grades_changed(record);
+    
+    return 1;
 }
 
 //    -   1,   0 ȯ
 int delete_grade(StudentRecord *record, const char *subject) {
-    int index = -1;
-    
     //   ã
-    for (int i = 0; i < record->subject_count; i++) {
-        if (strcmp(record->grades[i].subject, subject) == 0) {
-            index = i;
-            break;
-        }
-    }
+    int index = find_grade_index(record, find_subject_id(subject));
     
     //  ã  
     if (index == -1) {
@@ -117,6 +805,13 @@ int delete_grade(StudentRecord *record, const char *subject) {
         return 0;
     }
     
+    //  ΰ  հ迡   
+    int subject_id = record->grades[index].subject_id;
+    char old_grade = record->grades[index].grade;
+    update_subject_posting(record, subject_id, NULL);
+    record->weighted_sum -= (double)record->grades[index].score * record->grades[index].credit;
+    record->total_credits -= record->grades[index].credit;
+    
     //   迭 
     for (int i = index; i < record->subject_count - 1; i++) {
         record->grades[i] = record->grades[i + 1];
@@ -124,20 +819,24 @@ int delete_grade(StudentRecord *record, const char *subject) {
     
     record->subject_count--;
     
-    // GPA 
-    record->gpa = calculate_gpa(record);
+    //   Ǹ  迭 Ʒ ݳ ( հ赵 0)
+    if (record->subject_count == 0) {
+        release_grades(record);
+    }
+    update_grade_bitmaps(record, subject_id, old_grade, 0);
+    restore_duplicate_subject(record, subject_id);
+    
+    // GPA 
+    record->gpa = gpa_from_totals(record);
+    notify_grades_changed(record);
     
     return 1;
 }
 
 // Ư  ˻ - ã ش  ,  ã NULL ȯ
 Grade* search_grade(StudentRecord *record, const char *subject) {
-    for (int i = 0; i < record->subject_count; i++) {
-        if (strcmp(record->grades[i].subject, subject) == 0) {
-            return &record->grades[i];
-        }
-    }
-    return NULL;
+    int index = find_grade_index(record, find_subject_id(subject));
+    return (index != -1) ? &record->grades[index] : NULL;
 }
 
 //    (ġ  ܼ )
@@ -163,27 +862,154 @@ float calculate_total_credits(const StudentRecord *record) {
     return total;
 }
 
-// GPA  (  )
-float calculate_gpa(StudentRecord *record) {
-    if (record->subject_count == 0) {
-        return 0.0;
+//   ϳ  ä  x  հ    (SIMD,  κ Į)
+// Grade 16Ʈ( ID, , , )̹Ƿ 4 Ϳ ġϿ /  
+//  score_to_grade     :  = 'A' + k + (k >> 2), k = 4 -  
+// հ calculate_gpa   ϹǷ  
+static void grade_run_kernel(Grade *grades, int n, double *weighted_sum, int *total_credits) {
+    double sum = 0.0;
+    int credit_sum = 0;
+    int i = 0;
+    
+#if defined(__AVX2__)
+    const __m256 cut90 = _mm256_set1_ps(90.0f);
+    const __m256 cut80 = _mm256_set1_ps(80.0f);
+    const __m256 cut70 = _mm256_set1_ps(70.0f);
+    const __m256 cut60 = _mm256_set1_ps(60.0f);
+    const __m256i four = _mm256_set1_epi32(4);
+    const __m256i letter_a = _mm256_set1_epi32('A');
+    
+    for (; i + 8 <= n; i += 8) {
+        // 128Ʈ  0  i..i+3,  1 i+4..i+7 ΰ κ 4x4 ġ
+        const float *p = (const float*)(grades + i);
+        __m256 r0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p)), _mm_loadu_ps(p + 16), 1);
+        __m256 r1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 4)), _mm_loadu_ps(p + 20), 1);
+        __m256 r2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 8)), _mm_loadu_ps(p + 24), 1);
+        __m256 r3 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 12)), _mm_loadu_ps(p + 28), 1);
+        __m256d t0 = _mm256_castps_pd(_mm256_unpacklo_ps(r0, r1));
+        __m256d t1 = _mm256_castps_pd(_mm256_unpackhi_ps(r0, r1));
+        __m256d t2 = _mm256_castps_pd(_mm256_unpacklo_ps(r2, r3));
+        __m256d t3 = _mm256_castps_pd(_mm256_unpackhi_ps(r2, r3));
+        __m256 scores = _mm256_castpd_ps(_mm256_unpackhi_pd(t0, t2));
+        __m256i credits = _mm256_castpd_si256(_mm256_unpackhi_pd(t1, t3));
+        
+        //     -1̹Ƿ 4 ϸ -( )
+        __m256i passed = _mm256_add_epi32(
+            _mm256_add_epi32(_mm256_castps_si256(_mm256_cmp_ps(scores, cut90, _CMP_GE_OQ)),
+                             _mm256_castps_si256(_mm256_cmp_ps(scores, cut80, _CMP_GE_OQ))),
+            _mm256_add_epi32(_mm256_castps_si256(_mm256_cmp_ps(scores, cut70, _CMP_GE_OQ)),
+                             _mm256_castps_si256(_mm256_cmp_ps(scores, cut60, _CMP_GE_OQ))));
+        __m256i k = _mm256_add_epi32(four, passed);
+        __m256i letters = _mm256_add_epi32(letter_a, _mm256_add_epi32(k, _mm256_srli_epi32(k, 2)));
+        
+        //  x  double  ( հ  е)
+        double products[8];
+        int letter_out[8], credit_out[8];
+        _mm256_storeu_pd(products, _mm256_mul_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(scores)),
+                                                 _mm256_cvtepi32_pd(_mm256_castsi256_si128(credits))));
+        _mm256_storeu_pd(products + 4, _mm256_mul_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(scores, 1)),
+                                                     _mm256_cvtepi32_pd(_mm256_extractf128_si256(credits, 1))));
+        _mm256_storeu_si256((__m256i*)letter_out, letters);
+        _mm256_storeu_si256((__m256i*)credit_out, credits);
+        for (int j = 0; j < 8; j++) {
+            grades[i + j].grade = (char)letter_out[j];
+            sum += products[j];
+            credit_sum += credit_out[j];
+        }
+    }
+#endif
+#if defined(__SSE2__)
+    const __m128 cut90_4 = _mm_set1_ps(90.0f);
+    const __m128 cut80_4 = _mm_set1_ps(80.0f);
+    const __m128 cut70_4 = _mm_set1_ps(70.0f);
+    const __m128 cut60_4 = _mm_set1_ps(60.0f);
+    const __m128i four_4 = _mm_set1_epi32(4);
+    const __m128i letter_a_4 = _mm_set1_epi32('A');
+    
+    for (; i + 4 <= n; i += 4) {
+        //  4 ġϸ r1 , r3  
+        const float *p = (const float*)(grades + i);
+        __m128 r0 = _mm_loadu_ps(p);
+        __m128 r1 = _mm_loadu_ps(p + 4);
+        __m128 r2 = _mm_loadu_ps(p + 8);
+        __m128 r3 = _mm_loadu_ps(p + 12);
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+        __m128i credits = _mm_castps_si128(r3);
+        
+        //     -1̹Ƿ 4 ϸ -( )
+        __m128i passed = _mm_add_epi32(
+            _mm_add_epi32(_mm_castps_si128(_mm_cmpge_ps(r1, cut90_4)),
+                          _mm_castps_si128(_mm_cmpge_ps(r1, cut80_4))),
+            _mm_add_epi32(_mm_castps_si128(_mm_cmpge_ps(r1, cut70_4)),
+                          _mm_castps_si128(_mm_cmpge_ps(r1, cut60_4))));
+        __m128i k = _mm_add_epi32(four_4, passed);
+        __m128i letters = _mm_add_epi32(letter_a_4, _mm_add_epi32(k, _mm_srli_epi32(k, 2)));
+        
+        //  x  double  ( հ  е)
+        double products[4];
+        int letter_out[4], credit_out[4];
+        _mm_storeu_pd(products, _mm_mul_pd(_mm_cvtps_pd(r1), _mm_cvtepi32_pd(credits)));
+        _mm_storeu_pd(products + 2, _mm_mul_pd(_mm_cvtps_pd(_mm_movehl_ps(r1, r1)),
+                                               _mm_cvtepi32_pd(_mm_shuffle_epi32(credits, _MM_SHUFFLE(1, 0, 3, 2)))));
+        _mm_storeu_si128((__m128i*)letter_out, letters);
+        _mm_storeu_si128((__m128i*)credit_out, credits);
+        for (int j = 0; j < 4; j++) {
+            grades[i + j].grade = (char)letter_out[j];
+            sum += products[j];
+            credit_sum += credit_out[j];
+        }
+    }
+#endif
+    for (; i < n; i++) {
+        grades[i].grade = score_to_grade(grades[i].score);
+        sum += (double)grades[i].score * grades[i].credit;
+        credit_sum += grades[i].credit;
     }
     
-    float weighted_sum = 0.0;
-    float total_credits = 0.0;
+    *weighted_sum = sum;
+    *total_credits = credit_sum;
+}
+
+// ûũ [begin, end)  ް GPA  (Ը ̹Ƿ ûũ  ó)
+static void recalculate_gpa_chunk(void *context, int chunk, int begin, int end) {
+    StudentManager *manager = (StudentManager*)context;
+    (void)chunk;
     
-    for (int i = 0; i < record->subject_count; i++) {
-        weighted_sum += record->grades[i].score * record->grades[i].credit;
-        total_credits += record->grades[i].credit;
+    for (int slot = begin; slot < end; slot++) {
+        StudentRecord *record = get_record(manager, slot);
+        if (record->deleted) continue;
+        
+        grade_run_kernel(record->grades, record->subject_count,
+                         &record->weighted_sum, &record->total_credits);
+        record->gpa = gpa_from_totals(record);
+        manager->hot.gpa[slot] = record->gpa;
+        manager->hot.subject_count[slot] = record->subject_count;
     }
+}
+
+// ü л ް GPA    ( ε  ϰ Է  ȣ)
+// ڵ带  ûũ  Ǯ   SIMD Ŀη ,  x  հ,   ϰ
+//  ÷  н  (л notify_grades_changed й ȸ )
+void recalculate_all_gpa(StudentManager *manager) {
+    parallel_for_chunks(manager->slot_count, PARALLEL_CHUNK, recalculate_gpa_chunk, manager);
     
-    if (total_credits == 0.0) {
-        return 0.0;
+    //   GPA    ( ÷ ),  ٲǷ /Ʈ  籸 
+    rebuild_class_aggregates(manager);
+    manager->subject_index.stale = 1;
+    manager->bitmap_index.stale = 1;
+}
+
+// GPA  (  )
+float calculate_gpa(StudentRecord *record) {
+    //  հ踦  Ͽ ٽ  ( ε  ϰ Է  )
+    record->weighted_sum = 0.0;
+    record->total_credits = 0;
+    for (int i = 0; i < record->subject_count; i++) {
+        record->weighted_sum += (double)record->grades[i].score * record->grades[i].credit;
+        record->total_credits += record->grades[i].credit;
     }
     
-    // 0~100  GPA 0~4.5  ȯ
-    float gpa_100 = weighted_sum / total_credits;
-    return gpa_100 * 0.045;  //   ٸ ߰!
+    return gpa_from_totals(record);
 }
 
 // л ǥ  ( )
@@ -205,7 +1031,7 @@ void display_transcript(const StudentRecord *record) {
     
     for (int i = 0; i < record->subject_count; i++) {
         printf("%-20s %8.1f %6c %6d\n",
-               record->grades[i].subject,
+               get_subject_name(record->grades[i].subject_id),
                record->grades[i].score,
                record->grades[i].grade,
                record->grades[i].credit);
@@ -215,6 +1041,10 @@ void display_transcript(const StudentRecord *record) {
     printf(" ̼ : %.0f\n", calculate_total_credits(record));
     printf(" (0~100): %.2f\n", calculate_average_score(record));
     printf(" (GPA, 0~4.5): %.2f / 4.5\n", record->gpa);
+    if (record->owner) {
+        printf(": %d / %d\n", get_gpa_rank(record->owner, record->info.id),
+               record->owner->count);
+    }
     printf("==================================================\n");
 }
 
@@ -6,6 +6,37 @@
 #include <stdlib.h>
 #include <string.h>
 
+//   Լ ( <->  ID, α׷ ü )
+int intern_subject(const char *subject);
+int find_subject_id(const char *subject);
+const char* get_subject_name(int subject_id);
+void destroy_subject_dictionary(void);
+
+//  Ʒ Լ (л    迭)
+void init_grade_arena(GradeArena *arena);
+void destroy_grade_arena(GradeArena *arena);
+int reserve_grades(StudentRecord *record, int capacity);
+int reserve_loaded_grades(StudentRecord *record, int capacity);
+void release_grades(StudentRecord *record);
+int compact_grade_arena(StudentManager *manager);
+
+//   Լ (ں  ->  )
+void init_subject_index(SubjectIndex *index);
+void destroy_subject_index(SubjectIndex *index);
+int rebuild_subject_index(StudentManager *manager);
+const PostingList* get_subject_postings(const StudentManager *manager, int subject_id);
+const QuantileSketch* get_subject_sketch(const StudentManager *manager, int subject_id);
+void remove_subject_scores(StudentManager *manager, int slot);
+
+// Ʈ  Լ (, +,  л  )
+void init_bitmap_index(BitmapIndex *index);
+void destroy_bitmap_index(BitmapIndex *index);
+int rebuild_bitmap_index(StudentManager *manager);
+void update_major_bitmap(StudentManager *manager, int slot, int old_major_id, int new_major_id);
+int grade_letter_index(char grade);
+const RoaringBitmap* get_letter_bitmap(const StudentManager *manager, int subject_id, char grade);
+const RoaringBitmap* get_major_bitmap(const StudentManager *manager, int major_id);
+
 //   Լ
 int add_grade(StudentRecord *record, const char *subject, 
               float score, int credit);
@@ -15,6 +46,7 @@ Grade* search_grade(StudentRecord *record, const char *subject);
 
 //   Լ
 float calculate_gpa(StudentRecord *record);
+void recalculate_all_gpa(StudentManager *manager);
 char score_to_grade(float score);
 float calculate_average_score(const StudentRecord *record);
 float calculate_total_credits(const StudentRecord *record);
@@ -27,5 +59,6 @@ void display_grade_summary(const StudentRecord *record);
 int is_valid_score(float score);
 int is_valid_credit(int credit);
 int has_subject(const StudentRecord *record, const char *subject);
+int find_grade_index(const StudentRecord *record, int subject_id);
 
 #endif // GRADE_H
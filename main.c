@@ -2,6 +2,7 @@
 #include "grade.h"
 #include "utils.h"
 #include "file_handler.h"
+#include "thread_pool.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -40,6 +41,9 @@ void view_ranking_interactive(StudentManager *manager);
 void view_statistics_interactive(StudentManager *manager);
 void view_subject_statistics_interactive(StudentManager *manager);
 void search_by_gpa_range_interactive(StudentManager *manager);
+void filter_students_interactive(StudentManager *manager);
+void view_top_by_major_interactive(StudentManager *manager);
+void view_group_statistics_interactive(StudentManager *manager);
 
 //   ޴ Լ
 void handle_file_menu(StudentManager *manager);
@@ -146,6 +150,9 @@ void print_search_menu(void) {
     printf("  2. ü \n");
     printf("  3.  \n");
     printf("  4. GPA  ˻\n");
+    printf("  5.  ˻ (//)\n");
+    printf("  6.   л ȸ\n");
+    printf("  7. ׷캰  (//)\n");
     printf("  0.  ޴ ư\n");
     printf("\n");
 }
@@ -191,24 +198,52 @@ void search_student_interactive(StudentManager *manager) {
     printf("\n=== л ˻ ===\n");
     printf("1. й ˻\n");
     printf("2. ̸ ˻\n");
+    printf("3. ̸ պκ ˻ (: )\n");
     
     int choice = get_integer_input(": ");
-    StudentRecord *record = NULL;
     
     if (choice == 1) {
         int id = get_integer_input("й: ");
-        record = search_student_by_id(manager, id);
-    } else if (choice == 2) {
-        char name[MAX_NAME_LEN];
+        StudentRecord *record = search_student_by_id(manager, id);
+        if (record) {
+            display_student(record);
+        } else {
+            printf("\nл ã  ϴ.\n");
+        }
+        return;
+    }
+    
+    StudentResultSet *result = NULL;
+    char name[MAX_NAME_LEN];
+    
+    if (choice == 2) {
         get_string_input("̸: ", name, MAX_NAME_LEN);
-        record = search_student_by_name(manager, name);
+        result = search_students_by_name(manager, name);
+    } else if (choice == 3) {
+        get_string_input("̸ պκ: ", name, MAX_NAME_LEN);
+        result = search_students_by_name_prefix(manager, name);
     }
     
-    if (record) {
-        display_student(record);
+    if (result && result->count == 1 && choice == 2) {
+        display_student(result->items[0]);
+    } else if (result && result->count > 0) {
+        //  Ǵ ξ ˻  
+        printf("\n%-8s %-15s %-20s %s\n", "й", "̸", "", "GPA");
+        printf("-----------------------------------------------\n");
+        for (int i = 0; i < result->count; i++) {
+            printf("%-8d %-15s %-20s %.2f\n",
+                   result->items[i]->info.id,
+                   result->items[i]->info.name,
+                   result->items[i]->info.major,
+                   result->items[i]->gpa);
+        }
+        printf("-----------------------------------------------\n");
+        printf(" %d ˻\n", result->count);
     } else {
         printf("\nл ã  ϴ.\n");
     }
+    
+    free_result_set(result);
 }
 
 // л  (ȭ)
@@ -419,11 +454,115 @@ void search_by_gpa_range_interactive(StudentManager *manager) {
     search_students_by_gpa_range(manager, min_gpa, max_gpa);
 }
 
+//  ˻ (ȭ) -  Է ش   
+void filter_students_interactive(StudentManager *manager) {
+    printf("\n===  ˻ ( ĭ ü) ===\n");
+    
+    char subject[MAX_NAME_LEN];
+    get_string_input(": ", subject, MAX_NAME_LEN);
+    
+    char grade[4];
+    get_string_input(" (A/B/C/D/F): ", grade, 4);
+    if (grade[0] != '\0' && !strchr("ABCDF", grade[0])) {
+        printf(":  A, B, C, D, F  ϳ մϴ.\n");
+        return;
+    }
+    
+    char major[MAX_MAJOR_LEN];
+    get_string_input(": ", major, MAX_MAJOR_LEN);
+    
+    StudentResultSet *result = filter_students(manager, subject, grade[0], major);
+    if (result && result->count > 0) {
+        printf("\n%-8s %-15s %-20s %s\n", "й", "̸", "", "GPA");
+        printf("-----------------------------------------------\n");
+        for (int i = 0; i < result->count; i++) {
+            printf("%-8d %-15s %-20s %.2f\n",
+                   result->items[i]->info.id,
+                   result->items[i]->info.name,
+                   result->items[i]->info.major,
+                   result->items[i]->gpa);
+        }
+        printf("-----------------------------------------------\n");
+        printf(" %d ˻\n", result->count);
+    } else if (result) {
+        printf("\nǿ ´ л ϴ.\n");
+    }
+    
+    free_result_set(result);
+}
+
+//   л ȸ (ȭ)
+void view_top_by_major_interactive(StudentManager *manager) {
+    if (manager->count == 0) {
+        printf("\nϵ л ϴ.\n");
+        return;
+    }
+    
+    int n = get_integer_input("\n   : ");
+    if (n <= 0) {
+        printf(": 1 ̻̾ մϴ.\n");
+        return;
+    }
+    
+    MajorTopResult *result = get_top_students_by_major(manager, n);
+    if (!result) return;
+    
+    for (int g = 0; g < result->group_count; g++) {
+        const StudentResultSet *group = &result->groups[g];
+        if (group->count == 0) continue;
+        
+        printf("\n[%s]  %d\n", get_string(&manager->majors, g), group->count);
+        printf("%-6s %-8s %-15s %s\n", "", "й", "̸", "GPA");
+        printf("-----------------------------------------------\n");
+        for (int i = 0; i < group->count; i++) {
+            printf("%-6d %-8d %-15s %.2f\n",
+                   i + 1,
+                   group->items[i]->info.id,
+                   group->items[i]->info.name,
+                   group->items[i]->gpa);
+        }
+    }
+    
+    free_major_top_result(result);
+}
+
+// ׷캰  (ȭ) -  ȣ ̾ Էϸ  (: 12  + )
+void view_group_statistics_interactive(StudentManager *manager) {
+    if (manager->count == 0) {
+        printf("\nϵ л ϴ.\n");
+        return;
+    }
+    
+    char choice[8];
+    printf("\n: 1.   2.    3.  ( ̾ Է, : 13)\n");
+    get_string_input(": ", choice, 8);
+    
+    int keys = 0;
+    for (int i = 0; choice[i] != '\0'; i++) {
+        switch (choice[i]) {
+            case '1': keys |= GROUP_BY_MAJOR; break;
+            case '2': keys |= GROUP_BY_YEAR; break;
+            case '3': keys |= GROUP_BY_SUBJECT; break;
+            default:
+                printf(":  1, 2, 3 ߿ ؾ մϴ.\n");
+                return;
+        }
+    }
+    if (keys == 0) {
+        printf(":  ϳ ̻ ؾ մϴ.\n");
+        return;
+    }
+    
+    display_group_statistics(manager, keys);
+}
+
 //   (ȭ)
 void save_data_interactive(StudentManager *manager) {
     printf("\n===   ===\n");
     
+    // CSV   Ͽ  CSV  ǵ 
     if (save_data(manager, DEFAULT_DATA_FILE)) {
+        save_snapshot(manager, DEFAULT_SNAPSHOT_FILE);
         printf("?  Ϸ\n");
     } else {
         printf("?  \n");
@@ -566,6 +705,15 @@ void handle_search_menu(StudentManager *manager) {
             case 4:
                 search_by_gpa_range_interactive(manager);
                 break;
+            case 5:
+                filter_students_interactive(manager);
+                break;
+            case 6:
+                view_top_by_major_interactive(manager);
+                break;
+            case 7:
+                view_group_statistics_interactive(manager);
+                break;
             case 0:
                 break;
             default:
@@ -611,15 +759,19 @@ void handle_file_menu(StudentManager *manager) {
 
 //  Լ
 int main(void) {
-    // StudentManager  (ִ 100)
+    // StudentManager  (ʱ 뷮 100,  ʿ  ڵ Ȯ)
     StudentManager *manager = create_manager(MAX_STUDENTS);
     if (!manager) {
         fprintf(stderr, "ý ʱȭ \n");
         return 1;
     }
     
-    //     ڵ ε
-    if (file_exists(DEFAULT_DATA_FILE)) {
+    //   ڵ ε - CSV       
+    //   εϹǷ л ڵ ó ȸ  ä
+    if (is_snapshot_current(DEFAULT_SNAPSHOT_FILE, DEFAULT_DATA_FILE) &&
+        load_snapshot_lazy(manager, DEFAULT_SNAPSHOT_FILE)) {
+        printf("  ҷԽϴ.\n");
+    } else if (file_exists(DEFAULT_DATA_FILE)) {
         printf("   ߽߰ϴ.\n");
         load_data(manager, DEFAULT_DATA_FILE);
     }
@@ -658,7 +810,9 @@ int main(void) {
                                     save_choice, 10);
                     if (strcmp(save_choice, "yes") == 0|| 
                         strcmp(save_choice, "y") == 0) {
-                        save_data(manager, DEFAULT_DATA_FILE);
+                        if (save_data(manager, DEFAULT_DATA_FILE)) {
+                            save_snapshot(manager, DEFAULT_SNAPSHOT_FILE);
+                        }
                     }
                 }
                 break;
@@ -671,6 +825,8 @@ int main(void) {
     
     // ޸ 
     destroy_manager(manager);
+    destroy_subject_dictionary();
+    shutdown_thread_pool();
     
     printf("մϴ!\n");
     return 0;
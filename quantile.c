@@ -0,0 +1,75 @@
+#include "quantile.h"
+
+// ġ ʱȭ ( ġ)
+void init_quantile_sketch(QuantileSketch *sketch, float scale) {
+    memset(sketch, 0, sizeof(QuantileSketch));
+    sketch->scale = scale;
+}
+
+//    ȣ (ݿø,  ̸   )
+static int sketch_bucket(const QuantileSketch *sketch, float value) {
+    float position = value * sketch->scale + 0.5f;
+    if (!(position >= 0.0f)) return 0;
+    if (position >= (float)(SKETCH_BUCKETS - 1)) return SKETCH_BUCKETS - 1;
+    return (int)position;
+}
+
+//  ߰
+void sketch_add(QuantileSketch *sketch, float value) {
+    int bucket = sketch_bucket(sketch, value);
+    sketch->counts[bucket]++;
+    sketch->blocks[bucket >> SKETCH_BLOCK_SHIFT]++;
+    sketch->total++;
+}
+
+//   (߰ߴ ̾ )
+void sketch_remove(QuantileSketch *sketch, float value) {
+    int bucket = sketch_bucket(sketch, value);
+    if (sketch->counts[bucket] == 0) return;
+
+    sketch->counts[bucket]--;
+    sketch->blocks[bucket >> SKETCH_BLOCK_SHIFT]--;
+    sketch->total--;
+}
+
+// src ġ dest ħ -   1,  ٸ 0 ȯ
+int merge_quantile_sketch(QuantileSketch *dest, const QuantileSketch *src) {
+    if (dest->scale != src->scale) {
+        fprintf(stderr, ":  ٸ  ġ ĥ  ϴ.\n");
+        return 0;
+    }
+
+    for (int b = 0; b < SKETCH_BUCKETS; b++) {
+        dest->counts[b] += src->counts[b];
+    }
+    for (int k = 0; k < SKETCH_BLOCKS; k++) {
+        dest->blocks[k] += src->blocks[k];
+    }
+    dest->total += src->total;
+    return 1;
+}
+
+// q  ( :   ceil(q * total)°    )
+//  հ  ã      - ִ SKETCH_BLOCKS + 32 Ȯ
+float sketch_quantile(const QuantileSketch *sketch, double q) {
+    if (sketch->total == 0) return 0.0;
+
+    double rank = q * sketch->total;
+    long long target = (long long)rank;
+    if (target < rank) target++;
+    if (target < 1) target = 1;
+    if (target > sketch->total) target = sketch->total;
+
+    int block = 0;
+    while (target > sketch->blocks[block]) {
+        target -= sketch->blocks[block];
+        block++;
+    }
+
+    int bucket = block << SKETCH_BLOCK_SHIFT;
+    while (target > sketch->counts[bucket]) {
+        target -= sketch->counts[bucket];
+        bucket++;
+    }
+    return bucket / sketch->scale;
+}
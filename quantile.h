@@ -0,0 +1,34 @@
+#ifndef QUANTILE_H
+#define QUANTILE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SKETCH_BUCKETS 1024      //   ( 0 ~ (SKETCH_BUCKETS - 1) / scale)
+#define SKETCH_BLOCK_SHIFT 5     //  32     հ踦 Բ 
+#define SKETCH_BLOCKS (SKETCH_BUCKETS >> SKETCH_BLOCK_SHIFT)
+
+#define SCORE_SKETCH_SCALE 10.0f //  ġ  (0.1 , 0~100 -> 0~1000)
+#define GPA_SKETCH_SCALE 100.0f  // GPA ġ  (0.01 , 0~4.5 -> 0~450)
+
+//  ġ -       ׷
+// ߰/ O(1),  ȸ  հ踦  Ƿ л    ð
+//   ġ   ĥ   (庰 κ ,   CSV )
+typedef struct {
+    float scale;                 //  ->  ȣ  (  = 1 / scale)
+    int total;                   //   
+    int counts[SKETCH_BUCKETS];  //   
+    int blocks[SKETCH_BLOCKS];   // Ϻ   (counts 32  հ)
+} QuantileSketch;
+
+// ġ  Լ
+void init_quantile_sketch(QuantileSketch *sketch, float scale);
+void sketch_add(QuantileSketch *sketch, float value);
+void sketch_remove(QuantileSketch *sketch, float value);
+int merge_quantile_sketch(QuantileSketch *dest, const QuantileSketch *src);
+
+//  ȸ (q 0~1,   0)
+float sketch_quantile(const QuantileSketch *sketch, double q);
+
+#endif // QUANTILE_H
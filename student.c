@@ -1,6 +1,19 @@
 #include "student.h"
+#include "grade.h"
+#include "utils.h"
+#include "thread_pool.h"
+#include <limits.h>
+#include <pthread.h>
 
-// StudentManager  - ʱ 뷮ŭ ޸ Ҵ
+static void reset_class_aggregates(StudentManager *manager);
+static void rank_tree_insert(StudentManager *manager, int slot);
+static void rank_tree_remove(StudentManager *manager, int slot);
+static void end_lazy_records(StudentManager *manager);
+
+//  ڵ ä  -  ĵ   尡  ڵ忡 ó ص   ä
+static pthread_mutex_t lazy_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// StudentManager  - ʱ 뷮 Ʈ̸  ʿ信  ڵ Ȯ
 StudentManager* create_manager(int initial_capacity) {
     StudentManager *manager = (StudentManager*)malloc(sizeof(StudentManager));
     if (!manager) {
@@ -8,15 +21,52 @@ StudentManager* create_manager(int initial_capacity) {
         return NULL;
     }
     
-    manager->records = (StudentRecord*)malloc(sizeof(StudentRecord) * initial_capacity);
-    if (!manager->records) {
-        fprintf(stderr, "޸ Ҵ : StudentRecord 迭\n");
-        free(manager);
-        return NULL;
+    manager->chunks = NULL;
+    manager->chunk_count = 0;
+    manager->chunk_slots = 0;
+    manager->count = 0;
+    manager->slot_count = 0;
+    manager->capacity = 0;
+    manager->id_table = NULL;
+    manager->id_table_size = 0;
+    manager->name_index = NULL;
+    manager->name_index_count = 0;
+    manager->name_index_capacity = 0;
+    manager->name_index_stale = 0;
+    manager->delete_mode = DELETE_TOMBSTONE;
+    manager->compact_threshold = DEFAULT_COMPACT_THRESHOLD;
+    manager->compact_keep_order = 1;
+    for (int k = 0; k < SORT_KEY_COUNT; k++) {
+        manager->views[k].slots = NULL;
+        manager->views[k].count = 0;
+        manager->views[k].capacity = 0;
+        manager->views[k].valid = 0;
     }
+    manager->display_order = -1;
+    manager->hot.id = NULL;
+    manager->hot.gpa = NULL;
+    manager->hot.subject_count = NULL;
+    manager->hot.major_id = NULL;
+    manager->hot.live = NULL;
+    manager->hot.capacity = 0;
+    init_dictionary(&manager->majors);
+    init_grade_arena(&manager->grade_arena);
+    reset_class_aggregates(manager);
+    init_subject_index(&manager->subject_index);
+    init_bitmap_index(&manager->bitmap_index);
+    manager->rank_tree.nodes = NULL;
+    manager->rank_tree.capacity = 0;
+    manager->rank_tree.root = -1;
+    manager->rank_tree.stale = 0;
+    manager->lazy_rows = NULL;
+    manager->record_source.load = NULL;
+    manager->record_source.release = NULL;
+    manager->record_source.context = NULL;
     
-    manager->count = 0;
-    manager->capacity = initial_capacity;
+    if (!reserve_students(manager, initial_capacity > 0 ? initial_capacity : 1)) {
+        destroy_manager(manager);
+        return NULL;
+    }
     
     return manager;
 }
@@ -24,29 +74,1083 @@ StudentManager* create_manager(int initial_capacity) {
 // StudentManager ޸ 
 void destroy_manager(StudentManager *manager) {
     if (manager) {
-        if (manager->records) {
-            free(manager->records);
+        end_lazy_records(manager);
+        for (int i = 0; i < manager->chunk_count; i++) {
+            free(manager->chunks[i]);
+        }
+        free(manager->chunks);
+        free(manager->id_table);
+        free(manager->name_index);
+        for (int k = 0; k < SORT_KEY_COUNT; k++) {
+            free(manager->views[k].slots);
         }
+        free(manager->hot.id);
+        free(manager->hot.gpa);
+        free(manager->hot.subject_count);
+        free(manager->hot.major_id);
+        free(manager->hot.live);
+        destroy_dictionary(&manager->majors);
+        destroy_grade_arena(&manager->grade_arena);
+        destroy_subject_index(&manager->subject_index);
+        destroy_bitmap_index(&manager->bitmap_index);
+        free(manager->rank_tree.nodes);
         free(manager);
     }
 }
 
-// й ߺ üũ - ߺ̸ 1, ƴϸ 0 ȯ
-int is_duplicate_id(const StudentManager *manager, int id) {
-    for (int i = 0; i < manager->count; i++) {
-        if (manager->records[i].info.id == id) {
-            return 1;
+// л ߰/        ȿȭ
+void invalidate_sorted_views(StudentManager *manager) {
+    for (int k = 0; k < SORT_KEY_COUNT; k++) {
+        manager->views[k].valid = 0;
+    }
+}
+
+// ڿ  ڵ  ȣ -  ̰ų  ڵ -1
+int record_slot(const StudentRecord *record) {
+    if (!record->owner) return -1;
+    return find_student_slot(record->owner, record->info.id);
+}
+
+// GPA    ȣ (display_class_statistics  )
+static int gpa_bucket(float gpa) {
+    if (gpa >= 4.0) return 0;
+    else if (gpa >= 3.5) return 1;
+    else if (gpa >= 3.0) return 2;
+    else if (gpa >= 2.5) return 3;
+    else return 4;
+}
+
+//  踦 л  · ʱȭ
+static void clear_aggregates(ClassAggregates *agg) {
+    agg->graded_count = 0;
+    agg->gpa_sum = 0.0;
+    for (int b = 0; b < GPA_BUCKET_COUNT; b++) {
+        agg->gpa_buckets[b] = 0;
+    }
+    agg->top_slot = -1;
+    agg->low_slot = -1;
+    agg->extremes_valid = 1;
+    init_quantile_sketch(&agg->gpa_sketch, GPA_SKETCH_SCALE);
+}
+
+//  ü   ʱȭ (л  )
+static void reset_class_aggregates(StudentManager *manager) {
+    clear_aggregates(&manager->aggregates);
+}
+
+//    ÷   迡  (  л )
+static void aggregate_add(StudentManager *manager, int slot) {
+    ClassAggregates *agg = &manager->aggregates;
+    const float *gpa = manager->hot.gpa;
+    if (manager->hot.subject_count[slot] == 0) return;
+    
+    agg->graded_count++;
+    agg->gpa_sum += gpa[slot];
+    agg->gpa_buckets[gpa_bucket(gpa[slot])]++;
+    sketch_add(&agg->gpa_sketch, gpa[slot]);
+    
+    // ְ/ ĳð ȿϸ   񱳸 Ͽ  (̸   켱)
+    if (agg->extremes_valid) {
+        if (agg->top_slot == -1 || gpa[slot] > gpa[agg->top_slot] ||
+            (gpa[slot] == gpa[agg->top_slot] && slot < agg->top_slot)) {
+            agg->top_slot = slot;
+        }
+        if (agg->low_slot == -1 || gpa[slot] < gpa[agg->low_slot] ||
+            (gpa[slot] == gpa[agg->low_slot] && slot < agg->low_slot)) {
+            agg->low_slot = slot;
+        }
+    }
+}
+
+//    ÷   迡  ( ٲٱ  ȣ)
+static void aggregate_remove(StudentManager *manager, int slot) {
+    ClassAggregates *agg = &manager->aggregates;
+    float gpa = manager->hot.gpa[slot];
+    if (manager->hot.subject_count[slot] == 0) return;
+    
+    agg->graded_count--;
+    agg->gpa_sum -= gpa;
+    agg->gpa_buckets[gpa_bucket(gpa)]--;
+    sketch_remove(&agg->gpa_sketch, gpa);
+    if (agg->graded_count == 0) {
+        agg->gpa_sum = 0.0; // εҼ   
+    }
+    
+    // ְ/ л ڽ ٲ  ȸ  
+    if (slot == agg->top_slot || slot == agg->low_slot) {
+        agg->extremes_valid = 0;
+    }
+}
+
+//    ĵ - ûũ κ 踦  
+typedef struct {
+    const StudentManager *manager;
+    ClassAggregates *partials;   // ûũ κ 
+} AggregateScan;
+
+// ûũ [begin, end)  κ   ( ÷ , ̸   켱)
+static void aggregate_chunk(void *context, int chunk, int begin, int end) {
+    const AggregateScan *scan = (const AggregateScan*)context;
+    const HotColumns *hot = &scan->manager->hot;
+    ClassAggregates *part = &scan->partials[chunk];
+    
+    clear_aggregates(part);
+    for (int slot = begin; slot < end; slot++) {
+        if (!hot->live[slot] || hot->subject_count[slot] == 0) continue;
+        
+        float gpa = hot->gpa[slot];
+        part->graded_count++;
+        part->gpa_sum += gpa;
+        part->gpa_buckets[gpa_bucket(gpa)]++;
+        sketch_add(&part->gpa_sketch, gpa);
+        if (part->top_slot == -1 || gpa > hot->gpa[part->top_slot]) part->top_slot = slot;
+        if (part->low_slot == -1 || gpa < hot->gpa[part->low_slot]) part->low_slot = slot;
+    }
+}
+
+// κ 踦 ħ (ûũ  ľ  ó հ谡   )
+static void aggregate_merge(const StudentManager *manager, ClassAggregates *agg,
+                            const ClassAggregates *part) {
+    const float *gpa = manager->hot.gpa;
+    
+    agg->graded_count += part->graded_count;
+    agg->gpa_sum += part->gpa_sum;
+    for (int b = 0; b < GPA_BUCKET_COUNT; b++) {
+        agg->gpa_buckets[b] += part->gpa_buckets[b];
+    }
+    merge_quantile_sketch(&agg->gpa_sketch, &part->gpa_sketch);
+    if (part->top_slot != -1 && (agg->top_slot == -1 || gpa[part->top_slot] > gpa[agg->top_slot])) {
+        agg->top_slot = part->top_slot;
+    }
+    if (part->low_slot != -1 && (agg->low_slot == -1 || gpa[part->low_slot] < gpa[agg->low_slot])) {
+        agg->low_slot = part->low_slot;
+    }
+}
+
+//  ÷ ü ûũ   ĵϿ    (ڵ  )
+static void scan_class_aggregates(const StudentManager *manager, ClassAggregates *agg) {
+    int chunks = parallel_chunk_count(manager->slot_count, PARALLEL_CHUNK);
+    ClassAggregates single;
+    AggregateScan scan = { manager, NULL };
+    
+    clear_aggregates(agg);
+    if (chunks > 1) {
+        scan.partials = (ClassAggregates*)malloc(sizeof(ClassAggregates) * chunks);
+    }
+    
+    if (scan.partials) {
+        parallel_for_chunks(manager->slot_count, PARALLEL_CHUNK, aggregate_chunk, &scan);
+        for (int c = 0; c < chunks; c++) {
+            aggregate_merge(manager, agg, &scan.partials[c]);
+        }
+        free(scan.partials);
+    } else {
+        // ûũ ϳ̰ų ޸  -  ûũ   ó
+        scan.partials = &single;
+        for (int c = 0; c < chunks; c++) {
+            int begin = c * PARALLEL_CHUNK;
+            int end = (begin + PARALLEL_CHUNK < manager->slot_count) ? begin + PARALLEL_CHUNK : manager->slot_count;
+            aggregate_chunk(&scan, 0, begin, end);
+            aggregate_merge(manager, agg, &single);
         }
     }
-    return 0;
+}
+
+//  ü   ȸ - ȿȭ ְ/ л   ĵϿ 
+const ClassAggregates* get_class_aggregates(const StudentManager *manager) {
+    //   ĳø ϹǷ const ڿ ȣ 
+    StudentManager *cache = (StudentManager*)manager;
+    ClassAggregates *agg = &cache->aggregates;
+    
+    if (!agg->extremes_valid) {
+        ClassAggregates scanned;
+        scan_class_aggregates(manager, &scanned);
+        agg->top_slot = scanned.top_slot;
+        agg->low_slot = scanned.low_slot;
+        agg->extremes_valid = 1;
+    }
+    return agg;
+}
+
+// ڵ (GPA) ٲ Ҽ ڿ ˸ (grade.c   Լ ȣ)
+void notify_grades_changed(StudentRecord *record) {
+    StudentManager *manager = record->owner;
+    int slot = record_slot(record);
+    if (slot == -1) return;
+    
+    aggregate_remove(manager, slot);
+    manager->hot.gpa[slot] = record->gpa;
+    manager->hot.subject_count[slot] = record->subject_count;
+    aggregate_add(manager, slot);
+    manager->views[SORT_BY_GPA].valid = 0;
+    
+    // GPA ٲ 쿡  Ʈ ġ ̵
+    RankTree *tree = &manager->rank_tree;
+    if (!tree->stale && tree->nodes[slot].gpa != record->gpa) {
+        rank_tree_remove(manager, slot);
+        rank_tree_insert(manager, slot);
+    }
+}
+
+//  ÷ GPA/   踦 ٽ  ( ϰ   ȣ, ڵ  )
+void rebuild_class_aggregates(StudentManager *manager) {
+    scan_class_aggregates(manager, &manager->aggregates);
+    manager->views[SORT_BY_GPA].valid = 0;
+    manager->rank_tree.stale = 1;
+}
+
+// ڵ   ÷ ݿ -   1,      0 ȯ (̶  ÷ ٲ )
+static int write_hot_columns(StudentManager *manager, int slot) {
+    const StudentRecord *record = get_record(manager, slot);
+    int major_id = intern_string(&manager->majors, record->info.major);
+    if (major_id == -1) return 0;
+    
+    manager->hot.id[slot] = record->info.id;
+    manager->hot.gpa[slot] = record->gpa;
+    manager->hot.subject_count[slot] = record->subject_count;
+    manager->hot.major_id[slot] = major_id;
+    manager->hot.live[slot] = !record->deleted;
+    update_major_bitmap(manager, slot, -1, major_id);
+    return 1;
+}
+
+//  迭  ũ -  ũ⸦  辿 ÷ needed ̻ (ûũ ü ٽ  ʵ)
+static int grown_capacity(int current, int needed) {
+    long long capacity = current > 0 ? current : needed;
+    while (capacity < needed) capacity *= 2;
+    return capacity <= INT_MAX ? (int)capacity : needed;
+}
+
+//  ÷ 迭 capacity ̻ Ȯ -   1,   0 ȯ
+static int reserve_hot_columns(StudentManager *manager, int capacity) {
+    HotColumns *hot = &manager->hot;
+    if (capacity <= hot->capacity) return 1;
+    capacity = grown_capacity(hot->capacity, capacity);
+    
+    int *id = (int*)realloc(hot->id, sizeof(int) * capacity);
+    if (id) hot->id = id;
+    float *gpa = (float*)realloc(hot->gpa, sizeof(float) * capacity);
+    if (gpa) hot->gpa = gpa;
+    int *subject_count = (int*)realloc(hot->subject_count, sizeof(int) * capacity);
+    if (subject_count) hot->subject_count = subject_count;
+    int *major_id = (int*)realloc(hot->major_id, sizeof(int) * capacity);
+    if (major_id) hot->major_id = major_id;
+    unsigned char *live = (unsigned char*)realloc(hot->live, sizeof(unsigned char) * capacity);
+    if (live) hot->live = live;
+    
+    if (!id || !gpa || !subject_count || !major_id || !live) {
+        fprintf(stderr, "޸ Ҵ :  ÷\n");
+        return 0;
+    }
+    hot->capacity = capacity;
+    return 1;
+}
+
+//  from ڵ  ÷  to ̵ (,  ڵ ä ʰ   ȣ ű)
+// from  ȣ  ξ ߿  Կ ߰Ǵ л    
+static void move_slot(StudentManager *manager, int from, int to) {
+    HotColumns *hot = &manager->hot;
+    *record_storage(manager, to) = *record_storage(manager, from);
+    if (manager->lazy_rows) {
+        manager->lazy_rows[to] = manager->lazy_rows[from];
+        manager->lazy_rows[from] = 0;
+    }
+    hot->id[to] = hot->id[from];
+    hot->gpa[to] = hot->gpa[from];
+    hot->subject_count[to] = hot->subject_count[from];
+    hot->major_id[to] = hot->major_id[from];
+    hot->live[to] = hot->live[from];
+}
+
+// й ؽ Լ ( Ʈ ȥ)
+static unsigned int hash_id(int id) {
+    unsigned int h = (unsigned int)id;
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+// ؽ ̺( ids 迭 ġ) й  ġ ã -  ش й   ĭ ġ ȯ
+static int probe_id_table(const int *table, int size, const int *ids, int id) {
+    unsigned int mask = (unsigned int)size - 1;
+    unsigned int pos = hash_id(id) & mask;
+    
+    while (table[pos] != -1 && ids[table[pos]] != id) {
+        pos = (pos + 1) & mask;
+    }
+    return (int)pos;
+}
+
+//  й ε й ġ ã (  ȣ, й  ÷ )
+static int id_table_probe(const StudentManager *manager, int id) {
+    return probe_id_table(manager->id_table, manager->id_table_size, manager->hot.id, id);
+}
+
+// ؽ ̺ size ũ ٽ   ڵ ü 
+static int id_table_resize(StudentManager *manager, int size) {
+    int *table = (int*)malloc(sizeof(int) * size);
+    if (!table) {
+        fprintf(stderr, "޸ Ҵ : й ε\n");
+        return 0;
+    }
+    
+    free(manager->id_table);
+    manager->id_table = table;
+    manager->id_table_size = size;
+    rebuild_id_index(manager);
+    return 1;
+}
+
+// л n  50% Ϸ   ֵ ؽ ̺ Ȯ
+static int id_table_reserve(StudentManager *manager, int n) {
+    if (n * 2 <= manager->id_table_size) return 1;
+    
+    int size = manager->id_table_size > 0 ? manager->id_table_size : 16;
+    while (size < n * 2) size *= 2;
+    return id_table_resize(manager, size);
+}
+
+//  ڿ л count Ȯ  й ε ũ (ûũ  뷮 , ʹ ũ -1)
+//  ̸  ε    ũ  ε  ״   
+int id_index_size(int count) {
+    long long capacity = ((long long)count + RECORD_CHUNK_SIZE - 1) & ~(long long)RECORD_CHUNK_MASK;
+    long long size = 16;
+    while (size < capacity * 2) size *= 2;
+    return (size <= (1 << 30)) ? (int)size : -1;
+}
+
+// й 迭 ids[0, count) ؽ ̺ ä ( 迭 ġ, size 2 ŵ̸ count 2 ̻)
+void fill_id_index(int *table, int size, const int *ids, int count) {
+    for (int i = 0; i < size; i++) {
+        table[i] = -1;
+    }
+    for (int i = 0; i < count; i++) {
+        table[probe_id_table(table, size, ids, ids[i])] = i;
+    }
+}
+
+// ̸  й ε   ( ȣ =  ÷ ä  )
+// ũⰡ  ε ٸ  ÷ й ٽ 
+void adopt_id_index(StudentManager *manager, const int *table, int size) {
+    if (size == manager->id_table_size) {
+        memcpy(manager->id_table, table, sizeof(int) * size);
+    } else {
+        rebuild_id_index(manager);
+    }
+}
+
+// ؽ ̺ й  (Ĺ ̵  Ž ü )
+static void id_table_remove(StudentManager *manager, int id) {
+    unsigned int mask = (unsigned int)manager->id_table_size - 1;
+    unsigned int hole = (unsigned int)id_table_probe(manager, id);
+    if (manager->id_table[hole] == -1) return;
+    
+    unsigned int pos = hole;
+    while (1) {
+        pos = (pos + 1) & mask;
+        int slot = manager->id_table[pos];
+        if (slot == -1) break;
+        
+        //  ġ(home) ۰  ġ (ȯ ) ƴϸ  
+        unsigned int home = hash_id(manager->hot.id[slot]) & mask;
+        if (((pos - home) & mask) >= ((pos - hole) & mask)) {
+            manager->id_table[hole] = slot;
+            hole = pos;
+        }
+    }
+    manager->id_table[hole] = -1;
+}
+
+// й  ȣ ã -  -1 ȯ ( O(1))
+int find_student_slot(const StudentManager *manager, int id) {
+    if (manager->id_table_size == 0) return -1;
+    return manager->id_table[id_table_probe(manager, id)];
+}
+
+//  ڵ ġ  й ε ü 籸
+// , ϰ ε  ڵ尡 ̵  ȣ
+void rebuild_id_index(StudentManager *manager) {
+    for (int i = 0; i < manager->id_table_size; i++) {
+        manager->id_table[i] = -1;
+    }
+    for (int i = 0; i < manager->slot_count; i++) {
+        if (!manager->hot.live[i]) continue;
+        manager->id_table[id_table_probe(manager, manager->hot.id[i])] = i;
+    }
+}
+
+//  ̸ ε ׸  - (̸, ) 
+//  ̸ պκ  ̸   쿡 ڵ带 
+static int compare_name_entries(const StudentManager *manager,
+                                const NameIndexEntry *a, const NameIndexEntry *b) {
+    int cmp = memcmp(a->key, b->key, NAME_KEY_LEN);
+    if (cmp == 0 && a->key[NAME_KEY_LEN - 1] != '\0') {
+        cmp = strcmp(get_record(manager, a->slot)->info.name + NAME_KEY_LEN,
+                     get_record(manager, b->slot)->info.name + NAME_KEY_LEN);
+    }
+    if (cmp == 0) {
+        cmp = (a->slot > b->slot) - (a->slot < b->slot);
+    }
+    return cmp;
+}
+
+// ̸ ε ׸ ˻  len Ʈ  (strncmp  )
+// Ȯ ġ ˻ len  ڱ Ͽ ȣ
+static int compare_name_query(const StudentManager *manager, const NameIndexEntry *entry,
+                              const char *query, int len) {
+    int head = (len < NAME_KEY_LEN) ? len : NAME_KEY_LEN;
+    int cmp = memcmp(entry->key, query, head);
+    if (cmp != 0 || len <= NAME_KEY_LEN) return cmp;
+    
+    return strncmp(get_record(manager, entry->slot)->info.name + NAME_KEY_LEN,
+                   query + NAME_KEY_LEN, len - NAME_KEY_LEN);
+}
+
+//   ̸ ε ׸  (̸ NAME_KEY_LEN ª  κ 0)
+static NameIndexEntry make_name_entry(const StudentManager *manager, int slot) {
+    NameIndexEntry entry;
+    const char *name = get_record(manager, slot)->info.name;
+    const char *end = (const char*)memchr(name, '\0', NAME_KEY_LEN);
+    memset(entry.key, 0, NAME_KEY_LEN);
+    memcpy(entry.key, name, end ? (size_t)(end - name) : NAME_KEY_LEN);
+    entry.slot = slot;
+    return entry;
+}
+
+// ׸  ġ (entry   ù ׸)  Ž
+static int name_index_lower_bound(const StudentManager *manager, const NameIndexEntry *entry) {
+    int lo = 0, hi = manager->name_index_count;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (compare_name_entries(manager, &manager->name_index[mid], entry) < 0) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+// ̸ ε  ߰ -   ϵ 
+static int name_index_insert(StudentManager *manager, int slot) {
+    if (manager->name_index_count == manager->name_index_capacity) {
+        int new_capacity = manager->name_index_capacity > 0 ? manager->name_index_capacity * 2 : 64;
+        NameIndexEntry *entries = (NameIndexEntry*)realloc(
+            manager->name_index, sizeof(NameIndexEntry) * new_capacity);
+        if (!entries) {
+            //    ˻  ü 籸
+            manager->name_index_stale = 1;
+            return 0;
+        }
+        manager->name_index = entries;
+        manager->name_index_capacity = new_capacity;
+    }
+    
+    NameIndexEntry entry = make_name_entry(manager, slot);
+    int pos = name_index_lower_bound(manager, &entry);
+    memmove(&manager->name_index[pos + 1], &manager->name_index[pos],
+            sizeof(NameIndexEntry) * (manager->name_index_count - pos));
+    manager->name_index[pos] = entry;
+    manager->name_index_count++;
+    return 1;
+}
+
+// ̸ ε   (ڵ ̸  ٲ  ȣ)
+static void name_index_remove(StudentManager *manager, int slot) {
+    NameIndexEntry entry = make_name_entry(manager, slot);
+    int pos = name_index_lower_bound(manager, &entry);
+    if (pos >= manager->name_index_count || manager->name_index[pos].slot != slot) return;
+    
+    memmove(&manager->name_index[pos], &manager->name_index[pos + 1],
+            sizeof(NameIndexEntry) * (manager->name_index_count - pos - 1));
+    manager->name_index_count--;
+}
+
+// 籸 Ŀ ׸ ( Լ   ü ̸ ϵ ̸ ͸ Բ )
+typedef struct {
+    NameIndexEntry entry;
+    const char *name;
+} NameSortEntry;
+
+// compare_name_entries   (Ű, Ű   ̸, )
+static int compare_name_sort_entries(const void *a, const void *b) {
+    const NameSortEntry *x = (const NameSortEntry *)a;
+    const NameSortEntry *y = (const NameSortEntry *)b;
+    int cmp = memcmp(x->entry.key, y->entry.key, NAME_KEY_LEN);
+    if (cmp == 0 && x->entry.key[NAME_KEY_LEN - 1] != '\0') {
+        cmp = strcmp(x->name + NAME_KEY_LEN, y->name + NAME_KEY_LEN);
+    }
+    if (cmp == 0) {
+        cmp = (x->entry.slot > y->entry.slot) - (x->entry.slot < y->entry.slot);
+    }
+    return cmp;
+}
+
+//  ڵ ü ̸ ε 籸
+// ϸ ε stale   ˻ ٽ õ
+void rebuild_name_index(StudentManager *manager) {
+    if (manager->count > manager->name_index_capacity) {
+        NameIndexEntry *entries = (NameIndexEntry*)realloc(
+            manager->name_index, sizeof(NameIndexEntry) * manager->count);
+        if (!entries) {
+            fprintf(stderr, "޸ Ҵ : ̸ ε\n");
+            return;
+        }
+        manager->name_index = entries;
+        manager->name_index_capacity = manager->count;
+    }
+    
+    int capacity = manager->count > 0 ? manager->count : 1;
+    NameSortEntry *sorted = (NameSortEntry*)malloc(sizeof(NameSortEntry) * capacity);
+    if (!sorted) {
+        fprintf(stderr, "޸ Ҵ : ̸ ε\n");
+        return;
+    }
+    
+    int n = 0;
+    for (int i = 0; i < manager->slot_count; i++) {
+        const StudentRecord *record = get_record(manager, i);
+        if (record->deleted) continue;
+        sorted[n].entry = make_name_entry(manager, i);
+        sorted[n].name = record->info.name;
+        n++;
+    }
+    qsort(sorted, n, sizeof(NameSortEntry), compare_name_sort_entries);
+    
+    for (int i = 0; i < n; i++) {
+        manager->name_index[i] = sorted[i].entry;
+    }
+    manager->name_index_count = n;
+    free(sorted);
+    
+    manager->name_index_stale = 0;
+}
+
+// ˻  len Ʈ ġϴ ε  [*first, *last) ã
+static void name_index_range(StudentManager *manager, const char *query, int len,
+                             int *first, int *last) {
+    if (manager->name_index_stale) {
+        rebuild_name_index(manager);
+    }
+    
+    int lo = 0, hi = manager->name_index_count;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (compare_name_query(manager, &manager->name_index[mid], query, len) < 0) lo = mid + 1;
+        else hi = mid;
+    }
+    *first = lo;
+    
+    hi = manager->name_index_count;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (compare_name_query(manager, &manager->name_index[mid], query, len) <= 0) lo = mid + 1;
+        else hi = mid;
+    }
+    *last = lo;
+}
+
+// ε    ȯ
+static StudentResultSet* make_name_result(StudentManager *manager, int first, int last) {
+    StudentResultSet *result = (StudentResultSet*)malloc(sizeof(StudentResultSet));
+    if (!result) {
+        fprintf(stderr, "޸ Ҵ : ˻ \n");
+        return NULL;
+    }
+    
+    result->count = last - first;
+    result->items = (StudentRecord**)malloc(sizeof(StudentRecord*) * (result->count > 0 ? result->count : 1));
+    if (!result->items) {
+        fprintf(stderr, "޸ Ҵ : ˻ \n");
+        free(result);
+        return NULL;
+    }
+    
+    for (int i = first; i < last; i++) {
+        result->items[i - first] = get_record(manager, manager->name_index[i].slot);
+    }
+    return result;
+}
+
+//  Ʈ  켱 b  1 ( ȣ ؽ,   ȣ )
+static int rank_higher(int a, int b) {
+    unsigned int priority_a = hash_id(a);
+    unsigned int priority_b = hash_id(b);
+    if (priority_a != priority_b) return priority_a > priority_b;
+    return a < b;
+}
+
+// κ Ʈ   ( Ʈ 0)
+static int rank_size(const RankTree *tree, int node) {
+    return (node == -1) ? 0 : tree->nodes[node].size;
+}
+
+// ڽ ٲ  κ Ʈ ũ 
+static void rank_update(RankTree *tree, int node) {
+    RankNode *n = &tree->nodes[node];
+    n->size = 1 + rank_size(tree, n->left) + rank_size(tree, n->right);
+}
+
+// 尡 (gpa, slot) ġ ̸ 1 - GPA  ,   
+static int rank_node_before(const RankTree *tree, int node, float gpa, int slot) {
+    if (tree->nodes[node].gpa != gpa) return tree->nodes[node].gpa > gpa;
+    return node < slot;
+}
+
+// node Ʈ (gpa, slot)  (*left) (*right) 
+static void rank_split(RankTree *tree, int node, float gpa, int slot, int *left, int *right) {
+    if (node == -1) {
+        *left = -1;
+        *right = -1;
+        return;
+    }
+    
+    RankNode *n = &tree->nodes[node];
+    if (rank_node_before(tree, node, gpa, slot)) {
+        rank_split(tree, n->right, gpa, slot, &n->right, right);
+        *left = node;
+    } else {
+        rank_split(tree, n->left, gpa, slot, left, &n->left);
+        *right = node;
+    }
+    rank_update(tree, node);
+}
+
+//  Ʈ  (a  尡 b ) - յ Ʈ ȯ
+static int rank_merge(RankTree *tree, int a, int b) {
+    if (a == -1) return b;
+    if (b == -1) return a;
+    
+    if (rank_higher(a, b)) {
+        tree->nodes[a].right = rank_merge(tree, tree->nodes[a].right, b);
+        rank_update(tree, a);
+        return a;
+    }
+    tree->nodes[b].left = rank_merge(tree, a, tree->nodes[b].left);
+    rank_update(tree, b);
+    return b;
+}
+
+// node Ʈ slot   - 켱 ڸ    Ʒ 
+static int rank_insert_at(RankTree *tree, int node, int slot) {
+    RankNode *x = &tree->nodes[slot];
+    if (node == -1) return slot;
+    
+    if (rank_higher(slot, node)) {
+        rank_split(tree, node, x->gpa, slot, &x->left, &x->right);
+        rank_update(tree, slot);
+        return slot;
+    }
+    
+    RankNode *n = &tree->nodes[node];
+    if (rank_node_before(tree, node, x->gpa, slot)) {
+        n->right = rank_insert_at(tree, n->right, slot);
+    } else {
+        n->left = rank_insert_at(tree, n->left, slot);
+    }
+    n->size++;
+    return node;
+}
+
+// node Ʈ slot   - ã ڸ  ڽ  ü
+static int rank_remove_at(RankTree *tree, int node, int slot) {
+    if (node == -1) return -1;
+    
+    RankNode *n = &tree->nodes[node];
+    if (node == slot) {
+        return rank_merge(tree, n->left, n->right);
+    }
+    
+    if (rank_node_before(tree, node, tree->nodes[slot].gpa, slot)) {
+        n->right = rank_remove_at(tree, n->right, slot);
+    } else {
+        n->left = rank_remove_at(tree, n->left, slot);
+    }
+    n->size--;
+    return node;
+}
+
+//    ÷ GPA ġ  (籸 ̸ )
+static void rank_tree_insert(StudentManager *manager, int slot) {
+    RankTree *tree = &manager->rank_tree;
+    if (tree->stale) return;
+    
+    RankNode *x = &tree->nodes[slot];
+    x->gpa = manager->hot.gpa[slot];
+    x->left = -1;
+    x->right = -1;
+    x->size = 1;
+    tree->root = rank_insert_at(tree, tree->root, slot);
+}
+
+//   Ʈ  (  Ű ġ ã)
+static void rank_tree_remove(StudentManager *manager, int slot) {
+    RankTree *tree = &manager->rank_tree;
+    if (tree->stale) return;
+    
+    tree->root = rank_remove_at(tree, tree->root, slot);
+}
+
+// GPA     Ʈ ü 籸 (ϰ ε/GPA / ,  ܿ O(n))
+// ĵ      Ʈ   
+void rebuild_rank_tree(StudentManager *manager) {
+    RankTree *tree = &manager->rank_tree;
+    
+    int n;
+    const int *order = get_sorted_view(manager, SORT_BY_GPA, &n);
+    int *stack = (int*)malloc(sizeof(int) * (n > 0 ? n : 1));
+    if (!order || !stack) {
+        fprintf(stderr, "޸ Ҵ :  Ʈ\n");
+        free(stack);
+        tree->stale = 1;
+        return;
+    }
+    
+    // 켱    带    ڽ 
+    // ÿ   κ Ʈ ȮǾǷ ׶ ũ 
+    int top = 0;
+    int last = -1;
+    for (int i = 0; i < n; i++) {
+        int node = order[i];
+        RankNode *x = &tree->nodes[node];
+        x->gpa = manager->hot.gpa[node];
+        x->right = -1;
+        
+        last = -1;
+        while (top > 0 && rank_higher(node, stack[top - 1])) {
+            last = stack[--top];
+            rank_update(tree, last);
+        }
+        x->left = last;
+        if (top > 0) tree->nodes[stack[top - 1]].right = node;
+        stack[top++] = node;
+    }
+    last = -1;
+    while (top > 0) {
+        last = stack[--top];
+        rank_update(tree, last);
+    }
+    
+    tree->root = last;
+    tree->stale = 0;
+    free(stack);
+}
+
+//  Ʈ ֽ Ȯ (ʿϸ 籸) -    0 ȯ
+//  籸 ϹǷ const ڿ ȣ 
+static int rank_tree_ready(const StudentManager *manager) {
+    if (manager->rank_tree.stale) rebuild_rank_tree((StudentManager*)manager);
+    return !manager->rank_tree.stale;
+}
+
+// й GPA  ȸ (1, Ҽ ° ڸ GPA   ) -  0 ȯ
+int get_gpa_rank(const StudentManager *manager, int id) {
+    int slot = find_student_slot(manager, id);
+    if (slot == -1 || !rank_tree_ready(manager)) return 0;
+    
+    // ڽź Ҽ ° ڸ GPA  л  (Ʈ GPA ̹Ƿ  )
+    const RankTree *tree = &manager->rank_tree;
+    int fixed = gpa_to_fixed(tree->nodes[slot].gpa);
+    int higher = 0;
+    int node = tree->root;
+    while (node != -1) {
+        if (gpa_to_fixed(tree->nodes[node].gpa) > fixed) {
+            higher += rank_size(tree, tree->nodes[node].left) + 1;
+            node = tree->nodes[node].right;
+        } else {
+            node = tree->nodes[node].left;
+        }
+    }
+    return higher + 1;
+}
+
+// GPA gpa  л  (inclusive 1̸  GPA )
+static int rank_count_above(const RankTree *tree, float gpa, int inclusive) {
+    int count = 0;
+    int node = tree->root;
+    while (node != -1) {
+        float value = tree->nodes[node].gpa;
+        if (value > gpa || (inclusive && value == gpa)) {
+            count += rank_size(tree, tree->nodes[node].left) + 1;
+            node = tree->nodes[node].right;
+        } else {
+            node = tree->nodes[node].left;
+        }
+    }
+    return count;
+}
+
+// GPA [min_gpa, max_gpa] л   - *first  (0) , л  ȯ
+// Ʈ GPA ̹Ƿ   ̸ get_students_by_rank    - O(log n)
+int get_gpa_range_ranks(const StudentManager *manager, float min_gpa, float max_gpa, int *first) {
+    *first = 0;
+    if (min_gpa > max_gpa || !rank_tree_ready(manager)) return 0;
+    
+    const RankTree *tree = &manager->rank_tree;
+    *first = rank_count_above(tree, max_gpa, 0);
+    return rank_count_above(tree, min_gpa, 1) - *first;
+}
+
+// node κ Ʈ(տ offset)   [first, last)  slots 
+static void rank_collect(const RankTree *tree, int node, int offset,
+                         int first, int last, int *slots) {
+    if (node == -1 || offset >= last || offset + tree->nodes[node].size <= first) return;
+    
+    int position = offset + rank_size(tree, tree->nodes[node].left);
+    rank_collect(tree, tree->nodes[node].left, offset, first, last, slots);
+    if (position >= first && position < last) {
+        slots[position - first] = node;
+    }
+    rank_collect(tree, tree->nodes[node].right, position + 1, first, last, slots);
+}
+
+// GPA   [first, last) (0,   )  ȣ slots 
+// slots last - first ̻̾ ϸ  л  ȯ - O(log n +  ũ)
+int get_students_by_rank(const StudentManager *manager, int first, int last, int *slots) {
+    if (first < 0) first = 0;
+    if (last > manager->count) last = manager->count;
+    if (first >= last) return 0;
+    
+    if (!rank_tree_ready(manager)) return 0;
+    
+    const RankTree *tree = &manager->rank_tree;
+    rank_collect(tree, tree->root, 0, first, last, slots);
+    return last - first;
+}
+
+//  Ʈ  迭 capacity ̻ Ȯ -   1,   0 ȯ
+static int reserve_rank_tree(StudentManager *manager, int capacity) {
+    RankTree *tree = &manager->rank_tree;
+    if (capacity <= tree->capacity) return 1;
+    capacity = grown_capacity(tree->capacity, capacity);
+    
+    RankNode *nodes = (RankNode*)realloc(tree->nodes, sizeof(RankNode) * capacity);
+    if (!nodes) {
+        fprintf(stderr, "޸ Ҵ :  Ʈ\n");
+        return 0;
+    }
+    tree->nodes = nodes;
+    tree->capacity = capacity;
+    return 1;
+}
+
+// ּ capacity   ֵ ûũ Ȯ -   1,   0 ȯ
+//  ûũ ̵ ʰ  ûũ ߰ǹǷ ڵ Ͱ 
+int reserve_students(StudentManager *manager, int capacity) {
+    if (capacity <= manager->capacity) return 1;
+    
+    int needed_chunks = (capacity + RECORD_CHUNK_SIZE - 1) >> RECORD_CHUNK_SHIFT;
+    
+    // ûũ  迭  辿 Ȯ ( 迭 Ҵ)
+    if (needed_chunks > manager->chunk_slots) {
+        int new_slots = manager->chunk_slots > 0 ? manager->chunk_slots : 4;
+        while (new_slots < needed_chunks) new_slots *= 2;
+        
+        StudentRecord **new_chunks = (StudentRecord**)realloc(
+            manager->chunks, sizeof(StudentRecord*) * new_slots);
+        if (!new_chunks) {
+            fprintf(stderr, "޸ Ҵ : ڵ ûũ ̺\n");
+            return 0;
+        }
+        manager->chunks = new_chunks;
+        manager->chunk_slots = new_slots;
+    }
+    
+    while (manager->chunk_count < needed_chunks) {
+        StudentRecord *chunk = (StudentRecord*)malloc(
+            sizeof(StudentRecord) * RECORD_CHUNK_SIZE);
+        if (!chunk) {
+            fprintf(stderr, "޸ Ҵ : StudentRecord ûũ\n");
+            return 0;
+        }
+        manager->chunks[manager->chunk_count++] = chunk;
+        manager->capacity += RECORD_CHUNK_SIZE;
+    }
+    
+    // þ 뷮   ÷,  Ʈ, й ε ̸ Ȯ (  辿 Ȯ)
+    int old_columns = manager->hot.capacity;
+    if (!reserve_hot_columns(manager, manager->capacity) ||
+        !reserve_rank_tree(manager, manager->capacity)) {
+        return 0;
+    }
+    
+    //  ε ̸  ȣ ǥ  ÷ ũ ø   ä (0) 
+    if (manager->lazy_rows && manager->hot.capacity > old_columns) {
+        int *rows = (int*)realloc(manager->lazy_rows, sizeof(int) * manager->hot.capacity);
+        if (!rows) {
+            fprintf(stderr, "޸ Ҵ :  ڵ ǥ\n");
+            return 0;
+        }
+        memset(rows + old_columns, 0, sizeof(int) * (manager->hot.capacity - old_columns));
+        manager->lazy_rows = rows;
+    }
+    return id_table_reserve(manager, manager->capacity);
+}
+
+// ü л   (Ҵ ûũ   ,  Ʒ )
+void clear_students(StudentManager *manager) {
+    end_lazy_records(manager);
+    destroy_grade_arena(&manager->grade_arena);
+    destroy_subject_index(&manager->subject_index);
+    destroy_bitmap_index(&manager->bitmap_index);
+    reset_class_aggregates(manager);
+    manager->rank_tree.root = -1;
+    manager->rank_tree.stale = 0;
+    manager->count = 0;
+    manager->slot_count = 0;
+    rebuild_id_index(manager);
+    manager->name_index_count = 0;
+    manager->name_index_stale = 0;
+    invalidate_sorted_views(manager);
+}
+
+//  ε  -  ϰ  ȣ ǥ  ( ä  ڵ )
+static void end_lazy_records(StudentManager *manager) {
+    if (manager->record_source.release) {
+        manager->record_source.release(manager->record_source.context);
+    }
+    manager->record_source.load = NULL;
+    manager->record_source.release = NULL;
+    manager->record_source.context = NULL;
+    free(manager->lazy_rows);
+    manager->lazy_rows = NULL;
+}
+
+//  ͸  л count  ڵ ġ -   1,   0 ȯ
+//  i  i° ̸, ȣڰ  ÷(й, GPA,  , ) й ε ä 
+// rebuild_class_aggregates ȣؾ . ϸ  ڰ ϰ clear_students  
+int begin_lazy_records(StudentManager *manager, int count, const RecordSource *source) {
+    clear_students(manager);
+    if (!reserve_students(manager, count)) {
+        return 0;
+    }
+    
+    int *rows = (int*)malloc(sizeof(int) * manager->hot.capacity);
+    if (!rows) {
+        fprintf(stderr, "޸ Ҵ :  ڵ ǥ\n");
+        return 0;
+    }
+    for (int i = 0; i < count; i++) {
+        rows[i] = i + 1;
+        manager->hot.live[i] = 1;
+    }
+    memset(rows + count, 0, sizeof(int) * (manager->hot.capacity - count));
+    
+    manager->lazy_rows = rows;
+    manager->record_source = *source;
+    manager->slot_count = count;
+    manager->count = count;
+    manager->name_index_stale = 1;
+    manager->rank_tree.stale = 1;
+    manager->subject_index.stale = 1;
+    manager->bitmap_index.stale = 1;
+    invalidate_sorted_views(manager);
+    return 1;
+}
+
+//  ä   ڵ(ջ ̳  迭 ޸ )   ڵ Ȯ
+// й/GPA/ ˻縦 ģ  ÷  ״ , ̸    ÷   0 
+// GPA ٲ Ƿ    Ʈ ״ ΰ   迡  ִ л 
+// (materialize_record  ȿ ȣǸ,  ĵ    ۾ڸ Ƿ  Ը ħ)
+static void settle_unloaded_record(StudentManager *manager, int index, StudentRecord *record) {
+    memset(record, 0, sizeof(StudentRecord));
+    record->info.id = manager->hot.id[index];
+    record->gpa = manager->hot.gpa[index];
+    record->owner = manager;
+    const char *major = get_string(&manager->majors, manager->hot.major_id[index]);
+    if (major) {
+        strncpy(record->info.major, major, MAX_MAJOR_LEN - 1);
+    }
+    
+    aggregate_remove(manager, index);
+    manager->hot.subject_count[index] = 0;
+}
+
+//  ڵ带  ä (get_record ó   ȣ) - ڵ  ȯ
+// б   ĵ ߿ Ҹ  Ƿ  ȿ ٽ Ȯϰ,
+// ڵ带  ä  (release)  ǥø  ٸ 尡 ϼ 븸  
+//   ϸ (RecordSource )   ڵ Ȯϰ  
+StudentRecord* materialize_record(const StudentManager *manager, int index) {
+    StudentManager *lazy = (StudentManager*)manager;
+    StudentRecord *record = record_storage(manager, index);
+    
+    pthread_mutex_lock(&lazy_lock);
+    int row = lazy->lazy_rows[index];
+    if (row != 0) {
+        memset(record, 0, sizeof(StudentRecord));
+        record->info.id = manager->hot.id[index];
+        record->gpa = manager->hot.gpa[index];
+        record->owner = lazy;
+        if (!lazy->record_source.load(record, row - 1, lazy->record_source.context)) {
+            fprintf(stderr, ": й %d      Ӵϴ.\n", record->info.id);
+            settle_unloaded_record(lazy, index, record);
+        }
+#if defined(__GNUC__)
+        __atomic_store_n(&lazy->lazy_rows[index], 0, __ATOMIC_RELEASE);
+#else
+        lazy->lazy_rows[index] = 0;
+#endif
+    }
+    pthread_mutex_unlock(&lazy_lock);
+    return record;
+}
+
+// ϼ ڵ带  ڿ ߰ϰ й ε 
+// ϰ ε̹Ƿ ̸ ε  ̸ ˻    籸
+//  迭 Ʒ ϹǷ  ڵ  迭 ȣڰ release_grades 
+//    ڵ , ߺ й̰ų ޸   NULL ȯ
+StudentRecord* append_student_record(StudentManager *manager, const StudentRecord *record) {
+    if (!reserve_students(manager, manager->slot_count + 1)) {
+        return NULL;
+    }
+    
+    int pos = id_table_probe(manager, record->info.id);
+    if (manager->id_table[pos] != -1) {
+        return NULL;
+    }
+    
+    StudentRecord *new_record = get_record(manager, manager->slot_count);
+    *new_record = *record;
+    new_record->grades = NULL;
+    new_record->grade_capacity = 0;
+    new_record->owner = manager;
+    new_record->deleted = 0;
+    if (!reserve_grades(new_record, record->subject_count)) {
+        return NULL;
+    }
+    if (record->subject_count > 0) {
+        memcpy(new_record->grades, record->grades, sizeof(Grade) * record->subject_count);
+    }
+    if (!write_hot_columns(manager, manager->slot_count)) {
+        release_grades(new_record);
+        return NULL;
+    }
+    aggregate_add(manager, manager->slot_count);
+    
+    manager->id_table[pos] = manager->slot_count;
+    manager->slot_count++;
+    manager->count++;
+    manager->name_index_stale = 1;
+    manager->rank_tree.stale = 1;
+    if (record->subject_count > 0) {
+        manager->subject_index.stale = 1;
+        manager->bitmap_index.stale = 1;
+    }
+    invalidate_sorted_views(manager);
+    return new_record;
+}
+
+// й ߺ üũ - ߺ̸ 1, ƴϸ 0 ȯ
+int is_duplicate_id(const StudentManager *manager, int id) {
+    return find_student_slot(manager, id) != -1;
 }
 
 //  л ߰ -   1,   0 ȯ
 int add_student(StudentManager *manager, int id, const char *name, 
                 const char *major, const char *reg_date) {
-    // 뷮 ʰ ˻
-    if (manager->count >= manager->capacity) {
-        fprintf(stderr, ": ִ л  ʰ (ִ: %d)\n", manager->capacity);
+    // ʿ  뷮 Ȯ
+    if (!reserve_students(manager, manager->slot_count + 1)) {
+        fprintf(stderr, ": л ڵ  Ȯ  ϴ.\n");
         return 0;
     }
     
@@ -57,7 +1161,7 @@ int add_student(StudentManager *manager, int id, const char *name,
     }
     
     //  л ڵ ʱȭ
-    StudentRecord *new_record = &manager->records[manager->count];
+    StudentRecord *new_record = get_record(manager, manager->slot_count);
     new_record->info.id = id;
     strncpy(new_record->info.name, name, MAX_NAME_LEN - 1);
     new_record->info.name[MAX_NAME_LEN - 1] = '\0';
@@ -67,71 +1171,196 @@ int add_student(StudentManager *manager, int id, const char *name,
     new_record->info.reg_date[10] = '\0';
     
     //   ʱȭ
+    new_record->grades = NULL;
     new_record->subject_count = 0;
+    new_record->grade_capacity = 0;
+    new_record->weighted_sum = 0.0;
+    new_record->total_credits = 0;
     new_record->gpa = 0.0;
+    new_record->owner = manager;
+    new_record->deleted = 0;
+    if (!write_hot_columns(manager, manager->slot_count)) {
+        fprintf(stderr, ":  '%s'()   ϴ.\n", new_record->info.major);
+        return 0;
+    }
+    rank_tree_insert(manager, manager->slot_count);
     
+    manager->id_table[id_table_probe(manager, id)] = manager->slot_count;
+    if (!manager->name_index_stale) {
+        name_index_insert(manager, manager->slot_count);
+    }
+    manager->slot_count++;
     manager->count++;
+    invalidate_sorted_views(manager);
     return 1;
 }
 
-// л  (й ) -   1,   0 ȯ
-int delete_student(StudentManager *manager, int id) {
-    int index = -1;
+//  ǥõ  ȸϿ ڵ带   - ȸ   ȯ
+// compact_keep_order 1̸   ϸ , 0̸  ڵ   ä
+// ̵ ڵ ʹ ٲǷ  Ŀ ٽ ˻ؾ 
+int compact_students(StudentManager *manager) {
+    int reclaimed = manager->slot_count - manager->count;
+    if (reclaimed == 0) return 0;
     
-    //  л ã
-    for (int i = 0; i < manager->count; i++) {
-        if (manager->records[i].info.id == id) {
-            index = i;
-            break;
+    if (manager->compact_keep_order) {
+        int write = 0;
+        for (int read = 0; read < manager->slot_count; read++) {
+            if (!manager->hot.live[read]) continue;
+            if (read != write) {
+                move_slot(manager, read, write);
+            }
+            write++;
+        }
+    } else {
+        //       ִ ڵ ä (̵ Ƚ ּȭ)
+        int tail = manager->slot_count - 1;
+        for (int hole = 0; hole < manager->count; hole++) {
+            if (manager->hot.live[hole]) continue;
+            while (!manager->hot.live[tail]) tail--;
+            move_slot(manager, tail, hole);
+            tail--;
         }
     }
     
+    manager->slot_count = manager->count;
+    
+    //  ȣ ٲǷ ε ְ/ л ĳ 籸
+    rebuild_id_index(manager);
+    manager->aggregates.extremes_valid = 0;
+    manager->name_index_stale = 1;
+    manager->subject_index.stale = 1;
+    manager->bitmap_index.stale = 1;
+    manager->rank_tree.stale = 1;
+    invalidate_sorted_views(manager);
+    
+    return reclaimed;
+}
+
+// л  (й ) -   1,   0 ȯ
+// DELETE_TOMBSTONE   ǥø ϹǷ O(1)̸,  
+// compact_threshold ϸ ڵ 
+int delete_student(StudentManager *manager, int id) {
+    //  л ã
+    int index = find_student_slot(manager, id);
+    
     // л ã  
     if (index == -1) {
         fprintf(stderr, ": й %d ã  ϴ.\n", id);
         return 0;
     }
     
-    //   迭  ( ҵ  ̵)
-    for (int i = index; i < manager->count - 1; i++) {
-        manager->records[i] = manager->records[i + 1];
+    // ε  Ͽ  ˻ Ÿ ʵ 
+    id_table_remove(manager, id);
+    if (!manager->name_index_stale) {
+        name_index_remove(manager, index);
     }
     
+    //  ,  Ʈ,      迭  Ʒ ݳ
+    aggregate_remove(manager, index);
+    rank_tree_remove(manager, index);
+    remove_subject_scores(manager, index);
+    StudentRecord *record = get_record(manager, index);
+    release_grades(record);
+    record->deleted = 1;
+    manager->hot.live[index] = 0;
+    manager->hot.subject_count[index] = 0;
     manager->count--;
+    invalidate_sorted_views(manager);
+    
+    if (manager->delete_mode == DELETE_SHIFT) {
+        //  :  ҵ    
+        int keep_order = manager->compact_keep_order;
+        manager->compact_keep_order = 1;
+        compact_students(manager);
+        manager->compact_keep_order = keep_order;
+    } else if (manager->compact_threshold > 0 &&
+               (long long)(manager->slot_count - manager->count) * 100 >=
+               (long long)manager->compact_threshold * manager->slot_count) {
+        compact_students(manager);
+    }
+    
     return 1;
 }
 
 // й л ˻ - ã ش ڵ ,  ã NULL ȯ
 StudentRecord* search_student_by_id(StudentManager *manager, int id) {
-    for (int i = 0; i < manager->count; i++) {
-        if (manager->records[i].info.id == id) {
-            return &manager->records[i];
-        }
-    }
-    return NULL;
+    int slot = find_student_slot(manager, id);
+    return (slot != -1) ? get_record(manager, slot) : NULL;
 }
 
 // ̸ л ˻ - ã ش ڵ ,  ã NULL ȯ
-// :    ù ° л ȯ
+// :    ù ° л ȯ (ü search_students_by_name )
 StudentRecord* search_student_by_name(StudentManager *manager, const char *name) {
-    for (int i = 0; i < manager->count; i++) {
-        if (strcmp(manager->records[i].info.name, name) == 0) {
-            return &manager->records[i];
-        }
+    int first, last;
+    name_index_range(manager, name, (int)strlen(name) + 1, &first, &last);
+    return (first < last) ? get_record(manager, manager->name_index[first].slot) : NULL;
+}
+
+// ̸ Ȯ ġϴ  л ˻ ( ,  )
+// ȯ  free_result_set 
+StudentResultSet* search_students_by_name(StudentManager *manager, const char *name) {
+    int first, last;
+    name_index_range(manager, name, (int)strlen(name) + 1, &first, &last);
+    return make_name_result(manager, first, last);
+}
+
+// ̸ prefix ϴ  л ˻ (:  ˻)
+// EUC-KR ̸ Ʈ  ϹǷ   ξ ˻ 
+StudentResultSet* search_students_by_name_prefix(StudentManager *manager, const char *prefix) {
+    int first, last;
+    name_index_range(manager, prefix, (int)strlen(prefix), &first, &last);
+    return make_name_result(manager, first, last);
+}
+
+// ˻   ޸ 
+void free_result_set(StudentResultSet *result) {
+    if (result) {
+        free(result->items);
+        free(result);
     }
-    return NULL;
 }
 
 // л   - ̸, ,  
 void update_student_info(StudentRecord *record, const char *name, 
                         const char *major, const char *reg_date) {
     if (name) {
+        // ڿ  ڵ ̸ ε ٰ  ̸ ٽ 
+        StudentManager *manager = record->owner;
+        int slot = -1;
+        if (manager && !manager->name_index_stale) {
+            slot = find_student_slot(manager, record->info.id);
+            if (slot != -1) name_index_remove(manager, slot);
+        }
+        
         strncpy(record->info.name, name, MAX_NAME_LEN - 1);
         record->info.name[MAX_NAME_LEN - 1] = '\0';
+        
+        if (slot != -1) name_index_insert(manager, slot);
+        if (manager) manager->views[SORT_BY_NAME].valid = 0;
     }
     if (major) {
-        strncpy(record->info.major, major, MAX_MAJOR_LEN - 1);
-        record->info.major[MAX_MAJOR_LEN - 1] = '\0';
+        char new_major[MAX_MAJOR_LEN];
+        strncpy(new_major, major, MAX_MAJOR_LEN - 1);
+        new_major[MAX_MAJOR_LEN - 1] = '\0';
+        
+        // ڿ  ڵ    ϰ, ϸ   
+        int slot = record_slot(record);
+        int major_id = -1;
+        if (slot != -1) {
+            major_id = intern_string(&record->owner->majors, new_major);
+            if (major_id == -1) {
+                fprintf(stderr, ":  '%s'()   ϴ.\n", new_major);
+            }
+        }
+        if (slot == -1 || major_id != -1) {
+            memcpy(record->info.major, new_major, MAX_MAJOR_LEN);
+        }
+        if (major_id != -1) {
+            StudentManager *manager = record->owner;
+            int old_major_id = manager->hot.major_id[slot];
+            manager->hot.major_id[slot] = major_id;
+            update_major_bitmap(manager, slot, old_major_id, major_id);
+        }
     }
     if (reg_date) {
         strncpy(record->info.reg_date, reg_date, 10);
@@ -154,7 +1383,7 @@ void display_student(const StudentRecord *record) {
         for (int i = 0; i < record->subject_count; i++) {
             printf("  %d. %s: %.1f (%c, %d)\n",
                    i + 1,
-                   record->grades[i].subject,
+                   get_subject_name(record->grades[i].subject_id),
                    record->grades[i].score,
                    record->grades[i].grade,
                    record->grades[i].credit);
@@ -164,24 +1393,35 @@ void display_student(const StudentRecord *record) {
 }
 
 // ü л   ( )
+// sort_by_* ȣ Ŀ ش   ,     
 void display_all_students(const StudentManager *manager) {
     if (manager->count == 0) {
         printf("\nϵ л ϴ.\n");
         return;
     }
     
+    //  :  䰡 Ǿ    (ʿ  籸), ƴϸ  
+    const int *order = NULL;
+    int order_count = manager->slot_count;
+    if (manager->display_order >= 0) {
+        order = get_sorted_view((StudentManager *)manager,
+                                (SortKey)manager->display_order, &order_count);
+    }
+    
     printf("\n===================== ü л  =====================\n");
     printf("%-8s %-15s %-20s %-12s %s\n", 
            "й", "̸", "", "", "GPA(0~4.5)");
     printf("----------------------------------------------------------\n");
     
-    for (int i = 0; i < manager->count; i++) {
+    for (int i = 0; i < order_count; i++) {
+        const StudentRecord *record = get_record(manager, order ? order[i] : i);
+        if (record->deleted) continue;
         printf("%-8d %-15s %-20s %-12s %.2f\n",
-               manager->records[i].info.id,
-               manager->records[i].info.name,
-               manager->records[i].info.major,
-               manager->records[i].info.reg_date,
-               manager->records[i].gpa);
+               record->info.id,
+               record->info.name,
+               record->info.major,
+               record->info.reg_date,
+               record->gpa);
     }
     
     printf("----------------------------------------------------------\n");
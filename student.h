@@ -4,12 +4,27 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include "dictionary.h"
+#include "bitmap.h"
+#include "quantile.h"
 
 //  
 #define MAX_NAME_LEN 50
 #define MAX_MAJOR_LEN 50
-#define MAX_STUDENTS 100
-#define MAX_SUBJECTS 10
+#define MAX_STUDENTS 100          // ʱ 뷮 Ʈ ( ƴ, ʿ  ڵ Ȯ)
+
+//  Ʒ  (л    )
+#define GRADE_BLOCK_SIZE 4096     // Ʒ  ϳ Grade ĭ 
+#define GRADE_RUN_MIN 4           // л   ּ ũ ( 2辿 )
+#define GRADE_RUN_CLASSES 24      //   ũ   (GRADE_RUN_MIN << 23 ĭ)
+
+// ڵ ûũ ũ (2 ŵ, ûũ  ȮϿ   )
+#define RECORD_CHUNK_SHIFT 10
+#define RECORD_CHUNK_SIZE (1 << RECORD_CHUNK_SHIFT)
+#define RECORD_CHUNK_MASK (RECORD_CHUNK_SIZE - 1)
+
+// ̸ ε ׸ ϴ ̸ պκ  (EUC-KR ѱ 4)
+#define NAME_KEY_LEN 8
 
 // л ⺻  ü
 typedef struct {
@@ -20,39 +35,275 @@ typedef struct {
 } Student;
 
 //   ü
+//       ϰ   ID  (grade.h )
 typedef struct {
-    char subject[MAX_NAME_LEN];  // 
+    int subject_id;              //  ID (get_subject_name  ȸ)
     float score;                 //  (0.0 ~ 100.0)
     char grade;                  //   (A, B, C, D, F)
     int credit;                  //  (1 ~ 4)
 } Grade;
 
+struct StudentManager;
+
 // л ü ڵ ü
+//     Ʒ ,   ڵ(owner == NULL) malloc 
+//  ߰  Űų Ʒ Ǹ grades ּҰ ٲ  
 typedef struct {
     Student info;                // л ⺻ 
-    Grade grades[MAX_SUBJECTS];  //  迭
+    Grade *grades;               //  迭 (  NULL)
     int subject_count;           // ϵ  
+    int grade_capacity;          // grades 迭 ũ
+    double weighted_sum;         //  x   հ (    )
+    int total_credits;           //  ̼  (    )
     float gpa;                   //  
+    struct StudentManager *owner; // Ҽ  (ε ſ,   ڵ NULL)
+    int deleted;                 //  ǥ (,    )
 } StudentRecord;
 
-// ü л  ü
+// ̸ ε ׸ - ̸ պκ Ͽ κ 񱳸 ڵ   ó
+typedef struct {
+    char key[NAME_KEY_LEN];      // ̸  NAME_KEY_LEN Ʈ ( κ 0)
+    int slot;                    // ڵ  ȣ
+} NameIndexEntry;
+
+// ˻   (ڵ  )
+typedef struct {
+    StudentRecord **items;       // ˻ ڵ  迭
+    int count;                   // ˻ л 
+} StudentResultSet;
+
+//  
+typedef enum {
+    SORT_BY_ID,                  // й 
+    SORT_BY_NAME,                // ̸ 
+    SORT_BY_GPA,                 // GPA 
+    SORT_KEY_COUNT
+} SortKey;
+
+//   - ڵ ״ ΰ ĵ  ȣ   (ڰ ĳ)
+typedef struct {
+    int *slots;                  //    ȣ 迭
+    int count;                   // 信 Ե л 
+    int capacity;                // slots 迭 ũ
+    int valid;                   // 0̸    籸
+} SortedView;
+
+//  ÷ - /˻ ĵ  д ʵ带  ȣ   迭 и
+// ̸, ,    (ݵ) ʹ StudentRecord 
+typedef struct {
+    int *id;                     // й
+    float *gpa;                  //  
+    int *subject_count;          // ϵ  
+    int *major_id;               //  ID (   )
+    unsigned char *live;         // 1̸  , 0̸  ǥ
+    int capacity;                // ÷ 迭 ũ
+} HotColumns;
+
+// GPA  Ʈ  ( ȣ ε, Ž   ĳ θ е 16Ʈ )
+typedef struct {
+    int left;                    //  ڽ  (-1̸ )
+    int right;                   //  ڽ  (-1̸ )
+    int size;                    // κ Ʈ  
+    float gpa;                   // Ʈ   GPA
+} RankNode;
+
+// GPA  Ʈ - (GPA ,  )  Ʈ (GPA    )
+//   ȣ ü̸ κ Ʈ ũ⸦ Բ ξ / /GPA  ȸ O(log n) ó
+// 켱  ȣ ؽ÷ ϹǷ   
+typedef struct {
+    RankNode *nodes;             // [] Ʈ 
+    int capacity;                //  迭 ũ
+    int root;                    // Ʈ  (-1̸  Ʈ)
+    int stale;                   // 1̸  ȸ  ü 籸
+} RankTree;
+
+//  Ʒ - л     ū Ͽ ߶ 
+//  ũ GRADE_RUN_MIN 2 ŵ ̸, ݳ  ũ ޺   
+//   ĭ   ĭ   ִ ϸ    
+typedef struct {
+    Grade **blocks;              // Ҵ   迭
+    int block_count;             // Ҵ  
+    int block_slots;             //   迭 ũ
+    Grade *current;              //   ߶  
+    int current_used;            // current ̹  ĭ 
+    int current_size;            // current  ũ
+    Grade *free_runs[GRADE_RUN_CLASSES]; // ũ ޺   (ݳ  ù ĭ    )
+    long used_cells;             // л  ĭ 
+    long free_cells;             //  Ͽ ִ ĭ 
+} GradeArena;
+
+// GPA    (4.0 ̻, 3.5 ̻, 3.0 ̻, 2.5 ̻, 2.5 ̸)
+#define GPA_BUCKET_COUNT 5
+
+//  ü   -  , л ߰/   ŵǹǷ ȸ  ĵ ʿ
+// ְ/ л ش л GPA ٲų   ȿȭǰ  ȸ  
+typedef struct {
+    int graded_count;            //  ϵ л 
+    double gpa_sum;              //  ϵ л GPA հ
+    int gpa_buckets[GPA_BUCKET_COUNT]; // GPA  л  ( ϵ л)
+    int top_slot;                // ְ GPA л  ( ִ л , ̸  ,  -1)
+    int low_slot;                //  GPA л  ( ִ л , ̸  ,  -1)
+    int extremes_valid;          // 0̸ top_slot/low_slot  ȸ  
+    QuantileSketch gpa_sketch;   // GPA  ġ ( ϵ л,  ȸ)
+} ClassAggregates;
+
+//    ׸ ( posting)
+typedef struct {
+    int slot;                    // л  ȣ
+    float score;                 // 
+    char grade;                  // 
+} SubjectPosting;
+
+//    
 typedef struct {
-    StudentRecord *records;      // л ڵ 迭 ( Ҵ)
-    int count;                   //  л 
-    int capacity;                // ִ   л 
+    SubjectPosting *items;       //   迭 ( )
+    int count;                   // ׸  ( ǥõ л ,   籸)
+    int capacity;                // 迭 ũ
+    QuantileSketch *sketch;      //   ġ ( л , ׸  NULL)
+} PostingList;
+
+//   -  ID   ( 踦   ϴ  )
+//  ǥõ л ׸ ȸ  ǳʶٰ,  ٲ ̳ ϰ ε Ŀ 籸
+typedef struct {
+    PostingList *lists;          //  ID ε̵Ǵ   迭
+    int list_count;              // lists 迭 ũ
+    int stale;                   // 1̸   ȸ  ü 籸
+} SubjectIndex;
+
+//    (A, B, C, D, F)
+#define GRADE_LETTER_COUNT 5
+
+// Ʈ  - Ǻ л   (  ˻ Ʈ  ó)
+//  ǥõ л Ʈ ȸ  ǳʶٰ, ̳ ϰ ε Ŀ 籸
+typedef struct {
+    RoaringBitmap letters[GRADE_LETTER_COUNT]; // ش   ϳ ִ л
+    RoaringBitmap *subject_letters;  // [ ID * GRADE_LETTER_COUNT + ]      л
+    int subject_capacity;        // subject_letters   
+    RoaringBitmap *majors;       // [ ID] ش  л
+    int major_capacity;          // majors   
+    int stale;                   // 1̸  ȸ  ü 籸
+} BitmapIndex;
+
+//  ڵ  - ó   ڵ带 ä ʰ   ȣ  (  ε)
+// load ⺻ ,  ,   ä  迭 reserve_loaded_grades Ȯؾ 
+// load  ó ä    ˻ϸ, ջ ̰ų ޸𸮰 ϸ ڵ  ٲ ʰ 0 ȯ
+// (̶ ڴ  ÷ й/GPA/    ڵ Ȯ)
+typedef struct {
+    int (*load)(StudentRecord *record, int row, void *context); //   1,   0
+    void (*release)(void *context); //   (clear_students, destroy_manager  ȣ)
+    void *context;               //   (NULL̸  ڵ )
+} RecordSource;
+
+// л  
+typedef enum {
+    DELETE_SHIFT,                //   ڵ带     (O(n))
+    DELETE_TOMBSTONE             //  ǥø ϰ    ȸ (O(1))
+} DeleteMode;
+
+// ü л  ü
+// ڵ  ũ ûũ Ǹ, Ȯ   ûũ ̵ Ƿ
+// search_student_by_id  ȯ ʹ ߰ Ŀ ȿ
+//     deleted ǥ÷ Ƿ  ȸ  ǳʶپ 
+// й/GPA/ / hot ÷ Ǿ ־ ü ĵ ÷ 
+typedef struct StudentManager {
+    StudentRecord **chunks;      // ڵ ûũ  迭 ( Ҵ)
+    int chunk_count;             // Ҵ ûũ 
+    int chunk_slots;             // ûũ  迭 ũ
+    int count;                   //  л  ( ǥ )
+    int slot_count;              //     ( ǥ )
+    int capacity;                //  Ҵ ڵ  (ûũ )
+    int *id_table;               // й ؽ ε ( ּҹ,   ȣ,  ĭ -1)
+    int id_table_size;           // ؽ ̺ ũ (2 ŵ)
+    NameIndexEntry *name_index;  // ̸ ε ((̸, )  ĵ 迭)
+    int name_index_count;        // ̸ ε ׸ 
+    int name_index_capacity;     // ̸ ε 迭 ũ
+    int name_index_stale;        // ϰ   籸 ʿϸ 1 ( ̸ ˻  籸)
+    DeleteMode delete_mode;      //   (⺻: DELETE_TOMBSTONE)
+    int compact_threshold;       //   (%)   ̸̻ ڵ  (0̸  ุ)
+    int compact_keep_order;      // 1̸     , 0̸  ڵ   ä
+    SortedView views[SORT_KEY_COUNT]; //   ĳ ( غ)
+    int display_order;           // ü    (SortKey, -1̸  )
+    HotColumns hot;              //  ÷ ( ȣ , ڵ ׻ ȭ)
+    StringDict majors;           //   (hot.major_id -> )
+    GradeArena grade_arena;      // л    
+    ClassAggregates aggregates;  //  ü   (get_class_aggregates ȸ)
+    SubjectIndex subject_index;  //   (get_subject_postings ȸ)
+    BitmapIndex bitmap_index;    // // Ʈ  (get_letter_bitmap  ȸ)
+    RankTree rank_tree;          // GPA  Ʈ (get_gpa_rank  ȸ)
+    int *lazy_rows;              // []  ä  ڵ   ȣ + 1 (0̸ ä,  ε尡 ƴϸ NULL)
+    RecordSource record_source;  //  ڵ 
 } StudentManager;
 
+// ڵ  ⺻  (   %)
+#define DEFAULT_COMPACT_THRESHOLD 25
+
+// index ° ڵ  ġ ( ڵ嵵 ä ,   ο)
+static inline StudentRecord* record_storage(const StudentManager *manager, int index) {
+    return &manager->chunks[index >> RECORD_CHUNK_SHIFT][index & RECORD_CHUNK_MASK];
+}
+
+// index ° ڵ尡   ä ʾҴ Ȯ
+// ٸ 尡 ä ڵ带   ֵ ȹ(acquire)  
+static inline int is_record_pending(const StudentManager *manager, int index) {
+#if defined(__GNUC__)
+    return __atomic_load_n(&manager->lazy_rows[index], __ATOMIC_ACQUIRE) != 0;
+#else
+    return manager->lazy_rows[index] != 0;
+#endif
+}
+
+StudentRecord* materialize_record(const StudentManager *manager, int index);
+
+// index ° ڵ  (0 <= index < capacity) -  ڵ ó    ä
+static inline StudentRecord* get_record(const StudentManager *manager, int index) {
+    if (manager->lazy_rows && is_record_pending(manager, index)) {
+        return materialize_record(manager, index);
+    }
+    return record_storage(manager, index);
+}
+
 // л  Լ
 StudentManager* create_manager(int initial_capacity);
 void destroy_manager(StudentManager *manager);
+int reserve_students(StudentManager *manager, int capacity);
+void clear_students(StudentManager *manager);
+StudentRecord* append_student_record(StudentManager *manager, const StudentRecord *record);
 int add_student(StudentManager *manager, int id, const char *name, 
                 const char *major, const char *reg_date);
 int delete_student(StudentManager *manager, int id);
+int compact_students(StudentManager *manager);
 StudentRecord* search_student_by_id(StudentManager *manager, int id);
 StudentRecord* search_student_by_name(StudentManager *manager, const char *name);
+StudentResultSet* search_students_by_name(StudentManager *manager, const char *name);
+StudentResultSet* search_students_by_name_prefix(StudentManager *manager, const char *prefix);
+void free_result_set(StudentResultSet *result);
 void display_student(const StudentRecord *record);
 void display_all_students(const StudentManager *manager);
 
+//  ε Լ ( ÷ ȣڰ ä ڵ ó   ä)
+int begin_lazy_records(StudentManager *manager, int count, const RecordSource *source);
+
+// ε/ĳ  ˸ Լ
+void invalidate_sorted_views(StudentManager *manager);
+void notify_grades_changed(StudentRecord *record);
+void rebuild_class_aggregates(StudentManager *manager);
+const ClassAggregates* get_class_aggregates(const StudentManager *manager);
+int record_slot(const StudentRecord *record);
+
+// й ε Լ
+int find_student_slot(const StudentManager *manager, int id);
+void rebuild_id_index(StudentManager *manager);
+int id_index_size(int count);
+void fill_id_index(int *table, int size, const int *ids, int count);
+void adopt_id_index(StudentManager *manager, const int *table, int size);
+void rebuild_name_index(StudentManager *manager);
+
+// GPA  Լ (ڵ   ǵ帮 )
+void rebuild_rank_tree(StudentManager *manager);
+int get_gpa_rank(const StudentManager *manager, int id);
+int get_students_by_rank(const StudentManager *manager, int first, int last, int *slots);
+int get_gpa_range_ranks(const StudentManager *manager, float min_gpa, float max_gpa, int *first);
+
 // ƿƼ Լ
 int is_duplicate_id(const StudentManager *manager, int id);
 void update_student_info(StudentRecord *record, const char *name, 
@@ -0,0 +1,90 @@
+// ׽Ʈ  κ -    ߰/// 
+//  ׽Ʈ ˻ Լ( ¸ ü ڵ  )  ΰ run_random_mutations ѱ
+// : gcc -std=c99 -O2 -I.. -o <׽Ʈ> <׽Ʈ>.c ../student.c ../grade.c ../utils.c
+//       ../file_handler.c ../dictionary.c ../bitmap.c ../quantile.c ../thread_pool.c -lpthread -lm
+// : ./<׽Ʈ> ( ġϸ 0, ƴϸ 1 ȯ)
+#ifndef TEST_COMMON_H
+#define TEST_COMMON_H
+
+#include "student.h"
+#include "grade.h"
+#include "utils.h"
+#include <stdarg.h>
+
+#define TEST_ITERATIONS 40000
+#define TEST_ID_RANGE 500
+#define TEST_SUBJECTS 8
+#define TEST_MAJORS 4
+#define TEST_CHECK_EVERY 97
+#define TEST_MAX_REPORTS 10
+
+static int failures = 0;
+static int test_step = 0;
+
+//     - ó  Ǹ  ܰ Բ 
+static void test_fail(const char *format, ...) {
+    if (failures < TEST_MAX_REPORTS) {
+        va_list args;
+        va_start(args, format);
+        printf(": %dܰ ", test_step);
+        vprintf(format, args);
+        printf("\n");
+        va_end(args);
+    }
+    failures++;
+}
+
+//    (    ƴ )
+static void random_profile(char *major, size_t major_size, char *reg_date, size_t date_size) {
+    snprintf(major, major_size, "%d", rand() % TEST_MAJORS);
+    if (rand() % 5 == 0) {
+        snprintf(reg_date, date_size, "");
+    } else {
+        snprintf(reg_date, date_size, "%d-03-01", 2020 + rand() % 4);
+    }
+}
+
+//  ܿ   TEST_ITERATIONS ϸ TEST_CHECK_EVERY ܰ踶, ׸  check ȣ
+// л ߰/, л ,  Ʒ ,  ,  ߰//   - ˻ Ƚ ȯ
+static int run_random_mutations(StudentManager *manager, unsigned int seed,
+                                void (*check)(StudentManager *manager)) {
+    char subject[32], major[32], reg_date[16];
+    int checks = 0;
+    
+    srand(seed);
+    for (test_step = 0; test_step < TEST_ITERATIONS; test_step++) {
+        int op = rand() % 20;
+        int id = 20240000 + rand() % TEST_ID_RANGE;
+        StudentRecord *record = search_student_by_id(manager, id);
+        snprintf(subject, sizeof(subject), "%d", rand() % TEST_SUBJECTS);
+        float score = (float)(rand() % 1001) / 10.0f;
+    
+        if (op < 4) {
+            random_profile(major, sizeof(major), reg_date, sizeof(reg_date));
+            if (!record) add_student(manager, id, "л", major, reg_date);
+        } else if (op < 6) {
+            if (record) delete_student(manager, id);
+        } else if (op == 6) {
+            compact_students(manager);
+        } else if (op == 7) {
+            compact_grade_arena(manager);
+        } else if (op == 8) {
+            random_profile(major, sizeof(major), reg_date, sizeof(reg_date));
+            if (record) update_student_info(record, NULL, major, NULL);
+        } else if (record && !has_subject(record, subject)) {
+            if (op < 14) add_grade(record, subject, score, 1 + rand() % 4);
+        } else if (record) {
+            if (op < 17) update_grade(record, subject, score);
+            else delete_grade(record, subject);
+        }
+    
+        if (test_step % TEST_CHECK_EVERY == 0) {
+            check(manager);
+            checks++;
+        }
+    }
+    check(manager);
+    return checks + 1;
+}
+
+#endif
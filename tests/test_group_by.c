@@ -0,0 +1,138 @@
+// ׷   - group_students 7  (/ /)  ü ڵ带    
+//  ߰/// /   ܰ,  ûũ    ū   Ȯ
+// /: test_common.h 
+#include "test_common.h"
+#include "thread_pool.h"
+#include <math.h>
+
+#define TEST_LARGE_COUNT (PARALLEL_CHUNK * 2 + 1000)
+
+static void fail(int keys, const char *what) {
+    test_fail(" %d - %s", keys, what);
+}
+
+//   4ڸ  (ڰ ƴϸ 0, group_students  Ģ)
+static int year_of(const char *reg_date) {
+    int year = 0;
+    for (int i = 0; i < 4; i++) {
+        if (reg_date[i] < '0' || reg_date[i] > '9') return 0;
+        year = year * 10 + (reg_date[i] - '0');
+    }
+    return year;
+}
+
+// ׷ ϳ ü ڵ忡  ٽ  
+static void check_group(const StudentManager *manager, int keys, const GroupStats *group) {
+    int student_count = 0, graded_count = 0;
+    int grade_counts[GRADE_LETTER_COUNT] = { 0 };
+    double gpa_sum = 0.0;
+    float min_gpa = 0.0f, max_gpa = 0.0f;
+    
+    for (int slot = 0; slot < manager->slot_count; slot++) {
+        const StudentRecord *record = get_record(manager, slot);
+        if (record->deleted) continue;
+        if ((keys & GROUP_BY_MAJOR) && manager->hot.major_id[slot] != group->major_id) continue;
+        if ((keys & GROUP_BY_YEAR) && year_of(record->info.reg_date) != group->year) continue;
+    
+        if (keys & GROUP_BY_SUBJECT) {
+            int j = find_grade_index(record, group->subject_id);
+            if (j == -1) continue;
+            grade_counts[grade_letter_index(record->grades[j].grade)]++;
+        } else {
+            for (int j = 0; j < record->subject_count; j++) {
+                grade_counts[grade_letter_index(record->grades[j].grade)]++;
+            }
+        }
+    
+        student_count++;
+        if (record->subject_count > 0) {
+            if (graded_count == 0 || record->gpa < min_gpa) min_gpa = record->gpa;
+            if (graded_count == 0 || record->gpa > max_gpa) max_gpa = record->gpa;
+            gpa_sum += record->gpa;
+            graded_count++;
+        }
+    }
+    
+    if (group->student_count != student_count) fail(keys, "л ");
+    if (group->graded_count != graded_count) fail(keys, " ִ л ");
+    if (group->min_gpa != min_gpa || group->max_gpa != max_gpa) fail(keys, "/ְ GPA");
+    if (fabs(group->average_gpa - (graded_count > 0 ? gpa_sum / graded_count : 0.0)) > 1e-5) {
+        fail(keys, " GPA");
+    }
+    for (int k = 0; k < GRADE_LETTER_COUNT; k++) {
+        if (group->grade_counts[k] != grade_counts[k]) fail(keys, " ");
+    }
+    if (!(keys & GROUP_BY_MAJOR) && group->major_id != -1) fail(keys, "   Ű");
+    if (!(keys & GROUP_BY_YEAR) && group->year != -1) fail(keys, "   Ű");
+    if (!(keys & GROUP_BY_SUBJECT) && group->subject_id != -1) fail(keys, "   Ű");
+}
+
+//  ׷ Ű  (, ,  )
+static int group_key_less(const GroupStats *a, const GroupStats *b) {
+    if (a->major_id != b->major_id) return a->major_id < b->major_id;
+    if (a->year != b->year) return a->year < b->year;
+    return a->subject_id < b->subject_id;
+}
+
+// 7    ˻
+// ׷츶  ϰ, ׷ л  հ谡 ü( ̸ л-  )   ׷ Ȯ
+static void check_manager(StudentManager *manager) {
+    int pairs = 0;
+    for (int slot = 0; slot < manager->slot_count; slot++) {
+        const StudentRecord *record = get_record(manager, slot);
+        if (!record->deleted) pairs += record->subject_count;
+    }
+    
+    for (int keys = 1; keys <= (GROUP_BY_MAJOR | GROUP_BY_YEAR | GROUP_BY_SUBJECT); keys++) {
+        GroupResult *result = group_students(manager, keys);
+        if (!result || result->keys != keys) {
+            fail(keys, " ");
+            free_group_result(result);
+            continue;
+        }
+    
+        int total = 0;
+        for (int g = 0; g < result->count; g++) {
+            if (g > 0 && !group_key_less(&result->groups[g - 1], &result->groups[g])) fail(keys, "Ű ");
+            if (result->groups[g].student_count == 0) fail(keys, " ׷");
+            check_group(manager, keys, &result->groups[g]);
+            total += result->groups[g].student_count;
+        }
+        if (total != ((keys & GROUP_BY_SUBJECT) ? pairs : manager->count)) fail(keys, "׷ հ");
+        free_group_result(result);
+    }
+}
+
+int main(void) {
+    StudentManager *manager = create_manager(16);
+    if (!manager) return 1;
+    
+    //  :    ֱ ˻
+    int checks = run_random_mutations(manager, 11, check_manager);
+    
+    // ū :  ûũ    ûũ   Ȯ
+    char subject[32], major[32], reg_date[16];
+    clear_students(manager);
+    for (int i = 0; i < TEST_LARGE_COUNT; i++) {
+        random_profile(major, sizeof(major), reg_date, sizeof(reg_date));
+        if (!add_student(manager, 30000000 + i, "л", major, reg_date)) {
+            fail(0, "ū  ߰");
+            break;
+        }
+        StudentRecord *record = search_student_by_id(manager, 30000000 + i);
+        int subject_count = rand() % (TEST_SUBJECTS + 1);
+        for (int s = 0; s < subject_count; s++) {
+            snprintf(subject, sizeof(subject), "%d", s);
+            add_grade(record, subject, (float)(rand() % 1001) / 10.0f, 1 + rand() % 4);
+        }
+    }
+    for (int i = 0; i < TEST_LARGE_COUNT; i += 7) {
+        delete_student(manager, 30000000 + i);
+    }
+    check_manager(manager);
+    checks++;
+    
+    printf("׷  ˻ %dȸ (  7),  %d\n", checks, failures);
+    destroy_manager(manager);
+    return failures == 0 ? 0 : 1;
+}
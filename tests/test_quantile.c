@@ -0,0 +1,92 @@
+//  ġ  -  ߰///   GPA   p10/߾Ӱ/p90
+//      (ceil(q * n)° , ġ   ݿø) 
+// /: test_common.h 
+#include "test_common.h"
+
+static int compare_float(const void *a, const void *b) {
+    float x = *(const float *)a;
+    float y = *(const float *)b;
+    return (x > y) - (x < y);
+}
+
+// ĵ  q  (sketch_quantile   ,   0)
+static float exact_quantile(const float *sorted, int n, double q, float scale) {
+    if (n == 0) return 0.0f;
+    
+    double rank = q * n;
+    long long target = (long long)rank;
+    if (target < rank) target++;
+    if (target < 1) target = 1;
+    if (target > n) target = n;
+    
+    int bucket = (int)(sorted[target - 1] * scale + 0.5f);
+    return bucket / scale;
+}
+
+// ġ      
+static void check_quantiles(const char *what, float *values, int n, float scale,
+                            float p10, float median, float p90) {
+    static const double qs[3] = { 0.1, 0.5, 0.9 };
+    float got[3] = { p10, median, p90 };
+    
+    qsort(values, n, sizeof(float), compare_float);
+    for (int k = 0; k < 3; k++) {
+        float want = exact_quantile(values, n, qs[k], scale);
+        if (got[k] != want) {
+            test_fail("%s q=%.1f ġ %.2f,  %.2f ( %d)", what, qs[k], got[k], want, n);
+        }
+    }
+}
+
+//    GPA    ˻
+static void check_manager(StudentManager *manager) {
+    float *values = (float*)malloc(sizeof(float) * (manager->slot_count > 0 ? manager->slot_count : 1));
+    if (!values) {
+        fprintf(stderr, "޸ Ҵ : ˻ \n");
+        failures++;
+        return;
+    }
+    
+    //  GPA:  ϵ л
+    int n = 0;
+    for (int slot = 0; slot < manager->slot_count; slot++) {
+        const StudentRecord *record = get_record(manager, slot);
+        if (!record->deleted && record->subject_count > 0) values[n++] = record->gpa;
+    }
+    ClassStatistics class_stats;
+    get_class_statistics(manager, &class_stats);
+    check_quantiles(" GPA", values, n, GPA_SKETCH_SCALE,
+                    class_stats.gpa_p10, class_stats.gpa_median, class_stats.gpa_p90);
+    
+    //  :   л ش  
+    for (int s = 0; s < TEST_SUBJECTS; s++) {
+        char subject[32];
+        snprintf(subject, sizeof(subject), "%d", s);
+        int subject_id = find_subject_id(subject);
+    
+        n = 0;
+        for (int slot = 0; slot < manager->slot_count; slot++) {
+            const StudentRecord *record = get_record(manager, slot);
+            if (record->deleted) continue;
+            int j = find_grade_index(record, subject_id);
+            if (j != -1) values[n++] = record->grades[j].score;
+        }
+        SubjectStatistics subject_stats;
+        get_subject_statistics(manager, subject, &subject_stats);
+        check_quantiles(subject, values, n, SCORE_SKETCH_SCALE,
+                        subject_stats.score_p10, subject_stats.score_median, subject_stats.score_p90);
+    }
+    
+    free(values);
+}
+
+int main(void) {
+    StudentManager *manager = create_manager(16);
+    if (!manager) return 1;
+    
+    int checks = run_random_mutations(manager, 7, check_manager);
+    
+    printf(" ˻ %dȸ,  %d\n", checks, failures);
+    destroy_manager(manager);
+    return failures == 0 ? 0 : 1;
+}
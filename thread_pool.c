@@ -0,0 +1,250 @@
+#include "thread_pool.h"
+#include <pthread.h>
+#include <stdint.h>
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+// ۾  -    ûũ ȣ [head, tail)
+//   ʺ , ڱ    ʿ ϳ  
+typedef struct {
+    pthread_mutex_t lock;
+    int head;
+    int tail;
+} WorkDeque;
+
+//   Ǯ - 0   ۾ û ȣ  
+typedef struct {
+    pthread_t threads[POOL_MAX_THREADS];
+    WorkDeque deques[POOL_MAX_THREADS];
+    int deques_ready;            //  ؽ ʱȭ 
+    int thread_count;            //    (ȣ  ), 0̸ CPU 
+    int started;                 //   ۾   (ȣ  )
+    int shutting_down;           //  û 
+    int busy;                    //  ۾   (ø/ ȣ ķ ó)
+    unsigned long generation;    // ۾  - ۾ 尡  ۾ ˾ƺ  
+    unsigned long base_generation; // ۾ 带   
+    int active;                  //  ۾ ġ  ۾  
+    pthread_mutex_t lock;
+    pthread_cond_t job_ready;
+    pthread_cond_t job_done;
+
+    //  ۾
+    ChunkTask task;
+    void *context;
+    int total;
+    int chunk_size;
+} ThreadPool;
+
+static ThreadPool pool = {
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .job_ready = PTHREAD_COND_INITIALIZER,
+    .job_done = PTHREAD_COND_INITIALIZER
+};
+
+//   CPU 
+static int detect_cpu_count(void) {
+    long count = 1;
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    count = (long)info.dwNumberOfProcessors;
+#elif defined(_SC_NPROCESSORS_ONLN)
+    count = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    if (count < 1) count = 1;
+    if (count > POOL_MAX_THREADS) count = POOL_MAX_THREADS;
+    return (int)count;
+}
+
+// ûũ  
+int parallel_chunk_count(int total, int chunk_size) {
+    if (total <= 0 || chunk_size <= 0) return 0;
+    return (total + chunk_size - 1) / chunk_size;
+}
+
+// ڱ  ʿ ûũ ϳ  -  -1
+static int take_own_chunk(int self) {
+    WorkDeque *deque = &pool.deques[self];
+    int chunk = -1;
+
+    pthread_mutex_lock(&deque->lock);
+    if (deque->head < deque->tail) {
+        chunk = deque->head++;
+    }
+    pthread_mutex_unlock(&deque->lock);
+    return chunk;
+}
+
+// ٸ   ʿ ûũ ϳ ġ -    -1
+static int steal_chunk(int self, int thread_count) {
+    for (int k = 1; k < thread_count; k++) {
+        WorkDeque *deque = &pool.deques[(self + k) % thread_count];
+        int chunk = -1;
+
+        pthread_mutex_lock(&deque->lock);
+        if (deque->head < deque->tail) {
+            chunk = --deque->tail;
+        }
+        pthread_mutex_unlock(&deque->lock);
+        if (chunk != -1) return chunk;
+    }
+    return -1;
+}
+
+//  ûũ   ó (ڱ  , ״ ٸ   ļ)
+static void run_chunks(int self) {
+    int thread_count = pool.started + 1;
+
+    for (;;) {
+        int chunk = take_own_chunk(self);
+        if (chunk == -1) chunk = steal_chunk(self, thread_count);
+        if (chunk == -1) return;
+
+        int begin = chunk * pool.chunk_size;
+        int end = begin + pool.chunk_size;
+        if (end > pool.total) end = pool.total;
+        pool.task(pool.context, chunk, begin, end);
+    }
+}
+
+// ۾  -   ۾ ٷȴٰ ûũ ó
+static void* worker_main(void *arg) {
+    int self = (int)(intptr_t)arg;
+
+    pthread_mutex_lock(&pool.lock);
+    unsigned long seen = pool.base_generation;
+    for (;;) {
+        while (!pool.shutting_down && pool.generation == seen) {
+            pthread_cond_wait(&pool.job_ready, &pool.lock);
+        }
+        if (pool.shutting_down) break;
+        seen = pool.generation;
+        pthread_mutex_unlock(&pool.lock);
+
+        run_chunks(self);
+
+        pthread_mutex_lock(&pool.lock);
+        if (--pool.active == 0) {
+            pthread_cond_signal(&pool.job_done);
+        }
+    }
+    pthread_mutex_unlock(&pool.lock);
+    return NULL;
+}
+
+// ۾ 尡   (pool.lock  ¿ ȣ) - ۾   ȯ
+static int ensure_workers(void) {
+    if (pool.started > 0) return pool.started;
+
+    if (!pool.deques_ready) {
+        for (int i = 0; i < POOL_MAX_THREADS; i++) {
+            pthread_mutex_init(&pool.deques[i].lock, NULL);
+        }
+        pool.deques_ready = 1;
+    }
+
+    int wanted = pool.thread_count > 0 ? pool.thread_count : detect_cpu_count();
+    pool.base_generation = pool.generation;
+    while (pool.started < wanted - 1) {
+        if (pthread_create(&pool.threads[pool.started], NULL, worker_main,
+                           (void*)(intptr_t)(pool.started + 1)) != 0) {
+            //      尡  ó
+            fprintf(stderr, ": ۾ 带   ϴ. (%d )\n", pool.started + 1);
+            break;
+        }
+        pool.started++;
+    }
+    return pool.started;
+}
+
+//    (ȣ  , 1̸  ó, 0̸ CPU ) -  ۾  
+void set_thread_count(int count) {
+    shutdown_thread_pool();
+
+    if (count < 0) count = 0;
+    if (count > POOL_MAX_THREADS) count = POOL_MAX_THREADS;
+    pthread_mutex_lock(&pool.lock);
+    pool.thread_count = count;
+    pthread_mutex_unlock(&pool.lock);
+}
+
+//  ۾    (ȣ  )
+int get_thread_count(void) {
+    pthread_mutex_lock(&pool.lock);
+    int count = pool.thread_count > 0 ? pool.thread_count : detect_cpu_count();
+    pthread_mutex_unlock(&pool.lock);
+    return count;
+}
+
+// ۾   (α׷   ȣ,   ۾  ٽ )
+void shutdown_thread_pool(void) {
+    pthread_mutex_lock(&pool.lock);
+    int started = pool.started;
+    pool.shutting_down = 1;
+    pthread_cond_broadcast(&pool.job_ready);
+    pthread_mutex_unlock(&pool.lock);
+
+    for (int i = 0; i < started; i++) {
+        pthread_join(pool.threads[i], NULL);
+    }
+
+    pthread_mutex_lock(&pool.lock);
+    pool.started = 0;
+    pool.shutting_down = 0;
+    pthread_mutex_unlock(&pool.lock);
+}
+
+// [0, total) ׸ chunk_size  task   - ûũ  ȯ
+// ûũ  total chunk_sizeθ Ƿ ûũ κ  ûũ  ġ
+//  ( )   
+int parallel_for_chunks(int total, int chunk_size, ChunkTask task, void *context) {
+    int chunks = parallel_chunk_count(total, chunk_size);
+    if (chunks == 0) return 0;
+
+    pthread_mutex_lock(&pool.lock);
+    int serial = pool.busy || chunks == 1 || total < PARALLEL_MIN_ITEMS || ensure_workers() == 0;
+    if (!serial) {
+        pool.busy = 1;
+        pool.task = task;
+        pool.context = context;
+        pool.total = total;
+        pool.chunk_size = chunk_size;
+
+        // ûũ 帶     
+        int thread_count = pool.started + 1;
+        for (int t = 0; t < thread_count; t++) {
+            WorkDeque *deque = &pool.deques[t];
+            pthread_mutex_lock(&deque->lock);
+            deque->head = (int)((long long)chunks * t / thread_count);
+            deque->tail = (int)((long long)chunks * (t + 1) / thread_count);
+            pthread_mutex_unlock(&deque->lock);
+        }
+
+        pool.active = pool.started;
+        pool.generation++;
+        pthread_cond_broadcast(&pool.job_ready);
+    }
+    pthread_mutex_unlock(&pool.lock);
+
+    if (serial) {
+        for (int chunk = 0; chunk < chunks; chunk++) {
+            int begin = chunk * chunk_size;
+            int end = (begin + chunk_size < total) ? begin + chunk_size : total;
+            task(context, chunk, begin, end);
+        }
+        return chunks;
+    }
+
+    // ȣ 嵵 0  ó  ۾ 尡  ⸦ ٸ
+    run_chunks(0);
+    pthread_mutex_lock(&pool.lock);
+    while (pool.active > 0) {
+        pthread_cond_wait(&pool.job_done, &pool.lock);
+    }
+    pool.busy = 0;
+    pthread_mutex_unlock(&pool.lock);
+    return chunks;
+}
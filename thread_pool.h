@@ -0,0 +1,25 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define POOL_MAX_THREADS 64      // ۾  ִ  (ȣ  )
+#define PARALLEL_CHUNK 16384     //  ۾  ûũ ׸  (ûũ    )
+#define PARALLEL_MIN_ITEMS 65536 // ̺ ׸  ȣ  ȥ ó
+
+// ûũ ۾ Լ - chunk° ûũ [begin, end) ׸ ó
+// ûũ κ   ΰ ȣڰ ûũ  ġ      
+typedef void (*ChunkTask)(void *context, int chunk, int begin, int end);
+
+//  Ǯ  Լ (Ǯ ù  ۾     )
+void set_thread_count(int count);
+int get_thread_count(void);
+void shutdown_thread_pool(void);
+
+//   Լ - ûũ  ȯ ( ûũ   ȯ)
+int parallel_chunk_count(int total, int chunk_size);
+int parallel_for_chunks(int total, int chunk_size, ChunkTask task, void *context);
+
+#endif // THREAD_POOL_H
@@ -1,10 +1,15 @@
 #include "utils.h"
+#include "grade.h"
+#include "thread_pool.h"
+#include <stdarg.h>
 
 // й   Լ ()
 int compare_by_id(const void *a, const void *b) {
     const StudentRecord *student_a = (const StudentRecord *)a;
     const StudentRecord *student_b = (const StudentRecord *)b;
-    return student_a->info.id - student_b->info.id;
+    
+    //  ÷ΰ   Ƿ   ȯ
+    return (student_a->info.id > student_b->info.id) - (student_a->info.id < student_b->info.id);
 }
 
 // ̸   Լ ()
@@ -25,201 +30,1147 @@ int compare_by_gpa(const void *a, const void *b) {
     return 0;
 }
 
-// й  ()
+//   ׸ - ȣ   Ű  ȣ  /ȯ  8Ʈ ̵
+typedef struct {
+    unsigned int key;            //   Ű (й Ǵ GPA ȯ )
+    int slot;                    // ڵ  ȣ
+} SortEntry;
+
+//   ׸  (Ű ,   ) - ҷ Ŀ
+static int compare_entry_by_key(const void *a, const void *b) {
+    const SortEntry *entry_a = (const SortEntry *)a;
+    const SortEntry *entry_b = (const SortEntry *)b;
+    
+    if (entry_a->key != entry_b->key) {
+        return (entry_a->key > entry_b->key) ? 1 : -1;
+    }
+    return (entry_a->slot > entry_b->slot) - (entry_a->slot < entry_b->slot);
+}
+
+// GPA Ҽ ° ڸ Ҽ  ȯ (: 4.02 -> 402)
+int gpa_to_fixed(float gpa) {
+    if (gpa <= 0.0) return 0;
+    return (int)(gpa * GPA_FIXED_SCALE + 0.5f);
+}
+
+// й ȣ   Ű ȯ (ȣ Ʈ    )
+static unsigned int id_sort_key(int id) {
+    return (unsigned int)id ^ 0x80000000u;
+}
+
+// GPA  ǵ GPA Ʈ ǥ   Ű
+// 0 ̻ float Ʈ ǥ ȣ   ص  谡 
+static unsigned int gpa_sort_key(float gpa) {
+    unsigned int bits = 0;
+    if (gpa > 0.0f) memcpy(&bits, &gpa, sizeof(bits));
+    return 0xFFFFFFFFu - bits;
+}
+
+// LSD   (8Ʈ 4ܰ,  )
+//  Ű ش ڸ  ܰ ǳʶ - й  ڸ κ Ƿ δ 2~3ܰ踸 
+//    迭(entries Ǵ buffer) ȯ
+static SortEntry* radix_sort_entries(SortEntry *entries, SortEntry *buffer, int n) {
+    int histogram[4][256];
+    memset(histogram, 0, sizeof(histogram));
+    
+    //  ڸ    
+    for (int i = 0; i < n; i++) {
+        unsigned int key = entries[i].key;
+        histogram[0][key & 0xFF]++;
+        histogram[1][(key >> 8) & 0xFF]++;
+        histogram[2][(key >> 16) & 0xFF]++;
+        histogram[3][key >> 24]++;
+    }
+    
+    SortEntry *src = entries;
+    SortEntry *dst = buffer;
+    
+    for (int pass = 0; pass < 4; pass++) {
+        int *count = histogram[pass];
+        int shift = pass * 8;
+        
+        //  ׸  Ŷ̸  ڸ   
+        if (count[(src[0].key >> shift) & 0xFF] == n) continue;
+        
+        // Ŷ  ġ  ()
+        int offset = 0;
+        for (int b = 0; b < 256; b++) {
+            int c = count[b];
+            count[b] = offset;
+            offset += c;
+        }
+        
+        for (int i = 0; i < n; i++) {
+            dst[count[(src[i].key >> shift) & 0xFF]++] = src[i];
+        }
+        
+        SortEntry *tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+    
+    return src;
+}
+
+//   籸 - ڵ ̵ ʰ (Ű, ) ָ 
+// GPA  GPA ̸     ( Ʈ  )
+static int build_sorted_view(StudentManager *manager, SortKey key) {
+    SortedView *view = &manager->views[key];
+    
+    if (manager->count > view->capacity) {
+        int *slots = (int*)realloc(view->slots, sizeof(int) * manager->count);
+        if (!slots) {
+            fprintf(stderr, "޸ Ҵ :  \n");
+            return 0;
+        }
+        view->slots = slots;
+        view->capacity = manager->count;
+    }
+    
+    if (key == SORT_BY_NAME) {
+        // ̸ ε ̹ (̸, )  ĵǾ Ƿ ״ 
+        if (manager->name_index_stale) {
+            rebuild_name_index(manager);
+        }
+        for (int i = 0; i < manager->name_index_count; i++) {
+            view->slots[i] = manager->name_index[i].slot;
+        }
+        view->count = manager->name_index_count;
+        view->valid = 1;
+        return 1;
+    }
+    
+    //    ۱   Ҵ
+    int alloc_count = (manager->count > 0) ? manager->count : 1;
+    SortEntry *entries = (SortEntry*)malloc(sizeof(SortEntry) * alloc_count * 2);
+    if (!entries) {
+        fprintf(stderr, "޸ Ҵ :  \n");
+        return 0;
+    }
+    
+    //  ǥõ  ϰ Ű  (  Ƿ    )
+    int n = 0;
+    const HotColumns *hot = &manager->hot;
+    for (int i = 0; i < manager->slot_count; i++) {
+        if (!hot->live[i]) continue;
+        
+        entries[n].key = (key == SORT_BY_ID) ? id_sort_key(hot->id[i])
+                                             : gpa_sort_key(hot->gpa[i]);
+        entries[n].slot = i;
+        n++;
+    }
+    
+    //  Ű̹Ƿ   , ҷ   
+    const SortEntry *sorted = entries;
+    if (n >= RADIX_SORT_THRESHOLD) {
+        sorted = radix_sort_entries(entries, entries + alloc_count, n);
+    } else {
+        qsort(entries, n, sizeof(SortEntry), compare_entry_by_key);
+    }
+    
+    for (int i = 0; i < n; i++) {
+        view->slots[i] = sorted[i].slot;
+    }
+    view->count = n;
+    view->valid = 1;
+    
+    free(entries);
+    return 1;
+}
+
+//   ȸ - ĵ  ȣ 迭 ȯ (*count л  )
+// ĳõ 䰡 ȿϸ ״ ϰ, л/  Ŀ ٽ 
+// ȯ 迭 ڰ ϸ    ȿ
+const int* get_sorted_view(StudentManager *manager, SortKey key, int *count) {
+    SortedView *view = &manager->views[key];
+    
+    if (!view->valid && !build_sorted_view(manager, key)) {
+        *count = 0;
+        return NULL;
+    }
+    
+    *count = view->count;
+    return view->slots;
+}
+
+// й  () - ڵ ״ ΰ ü    
 void sort_by_id(StudentManager *manager) {
-    if (manager->count <= 1) return;
-    qsort(manager->records, manager->count, 
-          sizeof(StudentRecord), compare_by_id);
+    int count;
+    if (get_sorted_view(manager, SORT_BY_ID, &count)) {
+        manager->display_order = SORT_BY_ID;
+    }
 }
 
-// ̸  ()
+// ̸  () - ڵ ״ ΰ ü    
 void sort_by_name(StudentManager *manager) {
-    if (manager->count <= 1) return;
-    qsort(manager->records, manager->count, 
-          sizeof(StudentRecord), compare_by_name);
+    int count;
+    if (get_sorted_view(manager, SORT_BY_NAME, &count)) {
+        manager->display_order = SORT_BY_NAME;
+    }
 }
 
-// GPA  ( -   տ)
+// GPA  ( -   տ) - ڵ ״ ΰ ü    
 void sort_by_gpa(StudentManager *manager) {
-    if (manager->count <= 1) return;
-    qsort(manager->records, manager->count, 
-          sizeof(StudentRecord), compare_by_gpa);
+    int count;
+    if (get_sorted_view(manager, SORT_BY_GPA, &count)) {
+        manager->display_order = SORT_BY_GPA;
+    }
 }
 
 // ü л   - GPA  
 // ڴ  ,   ǳʶ
-void calculate_rankings(StudentManager *manager) {
+// GPA  Ʈ   Ƿ ڵ    ٲ 
+void calculate_rankings(const StudentManager *manager) {
     if (manager->count == 0) return;
     
-    //  GPA 
-    sort_by_gpa(manager);
-    
     printf("\n=============== л  (GPA ) ===============\n");
     printf("%-6s %-8s %-15s %-20s %s\n", 
            "", "й", "̸", "", "GPA(0~4.5)");
     printf("----------------------------------------------------\n");
     
+    int slots[RANK_PAGE_SIZE];
     int rank = 1;
-    for (int i = 0; i < manager->count; i++) {
-        //  ó:  л GPA   
-        if (i > 0 && manager->records[i].gpa < manager->records[i-1].gpa) {
-            rank = i + 1;
-        }
+    int prev_fixed = -1;
+    
+    for (int first = 0; first < manager->count; first += RANK_PAGE_SIZE) {
+        int n = get_students_by_rank(manager, first, first + RANK_PAGE_SIZE, slots);
         
-        printf("%-6d %-8d %-15s %-20s %.2f\n",
-               rank,
-               manager->records[i].info.id,
-               manager->records[i].info.name,
-               manager->records[i].info.major,
-               manager->records[i].gpa);
+        for (int i = 0; i < n; i++) {
+            const StudentRecord *record = get_record(manager, slots[i]);
+            
+            //  ó:  л GPA(Ҽ ° ڸ)   
+            int fixed = gpa_to_fixed(record->gpa);
+            if (prev_fixed != -1 && fixed < prev_fixed) {
+                rank = first + i + 1;
+            }
+            prev_fixed = fixed;
+            
+            printf("%-6d %-8d %-15s %-20s %.2f\n",
+                   rank,
+                   record->info.id,
+                   record->info.name,
+                   record->info.major,
+                   record->gpa);
+        }
+        if (n == 0) break;
     }
     printf("====================================================\n");
 }
 
-// ü л  GPA 
+// ü л  GPA  ( ϵ л,   )
 float get_class_average_gpa(const StudentManager *manager) {
     if (manager->count == 0) return 0.0;
     
-    float total_gpa = 0.0;
-    int valid_count = 0;
-    
-    for (int i = 0; i < manager->count; i++) {
-        //  ϵ л 
-        if (manager->records[i].subject_count > 0) {
-            total_gpa += manager->records[i].gpa;
-            valid_count++;
-        }
-    }
-    
-    return (valid_count > 0) ? (total_gpa / valid_count) : 0.0;
+    const ClassAggregates *agg = &manager->aggregates;
+    return (agg->graded_count > 0) ? (float)(agg->gpa_sum / agg->graded_count) : 0.0;
 }
 
-// ְ GPA ã
+// ְ GPA ã (  л GPA 0̹Ƿ  ִ л  ְ )
 float get_highest_gpa(const StudentManager *manager) {
     if (manager->count == 0) return 0.0;
     
-    float max_gpa = manager->records[0].gpa;
-    for (int i = 1; i < manager->count; i++) {
-        if (manager->records[i].gpa > max_gpa) {
-            max_gpa = manager->records[i].gpa;
-        }
-    }
-    return max_gpa;
+    const ClassAggregates *agg = get_class_aggregates(manager);
+    return (agg->top_slot != -1) ? manager->hot.gpa[agg->top_slot] : 0.0;
 }
 
-//  GPA ã
+//  GPA ã ( ϵ л  , ׷ л  0)
 float get_lowest_gpa(const StudentManager *manager) {
     if (manager->count == 0) return 0.0;
     
-    float min_gpa = manager->records[0].gpa;
-    for (int i = 1; i < manager->count; i++) {
-        //   л 
-        if (manager->records[i].subject_count > 0 && 
-            manager->records[i].gpa < min_gpa) {
-            min_gpa = manager->records[i].gpa;
-        }
-    }
-    return min_gpa;
+    const ClassAggregates *agg = get_class_aggregates(manager);
+    return (agg->low_slot != -1) ? manager->hot.gpa[agg->low_slot] : 0.0;
 }
 
-// 1 л ã (ְ GPA)
-StudentRecord* get_top_student(StudentManager *manager) {
+// 1 л ã (ְ GPA, ̸  ϵ л)
+StudentRecord* get_top_student(const StudentManager *manager) {
     if (manager->count == 0) return NULL;
     
-    StudentRecord *top = &manager->records[0];
-    for (int i = 1; i < manager->count; i++) {
-        if (manager->records[i].gpa > top->gpa) {
-            top = &manager->records[i];
+    const HotColumns *hot = &manager->hot;
+    const ClassAggregates *agg = get_class_aggregates(manager);
+    if (agg->top_slot != -1 && hot->gpa[agg->top_slot] > 0.0) {
+        return get_record(manager, agg->top_slot);
+    }
+    
+    //  GPA 0̸ ù л
+    int first = 0;
+    while (!hot->live[first]) first++;
+    return get_record(manager, first);
+}
+
+//     ȯ - ޸   NULL
+static StudentResultSet* make_slot_result(const StudentManager *manager, const int *slots, int count) {
+    StudentResultSet *result = (StudentResultSet*)malloc(sizeof(StudentResultSet));
+    if (!result) {
+        fprintf(stderr, "޸ Ҵ : ˻ \n");
+        return NULL;
+    }
+    
+    result->count = count;
+    result->items = (StudentRecord**)malloc(sizeof(StudentRecord*) * (count > 0 ? count : 1));
+    if (!result->items) {
+        fprintf(stderr, "޸ Ҵ : ˻ \n");
+        free(result);
+        return NULL;
+    }
+    for (int i = 0; i < count; i++) {
+        result->items[i] = get_record(manager, slots[i]);
+    }
+    return result;
+}
+
+// GPA  k (GPA ,   ϵ л) - free_result_set 
+//  Ʈ   Ƿ ü   O(log n + k)
+StudentResultSet* get_top_students(const StudentManager *manager, int k) {
+    if (k > manager->count) k = manager->count;
+    if (k < 0) k = 0;
+    
+    int *slots = (int*)malloc(sizeof(int) * (k > 0 ? k : 1));
+    if (!slots) {
+        fprintf(stderr, "޸ Ҵ :  л\n");
+        return NULL;
+    }
+    
+    int count = get_students_by_rank(manager, 0, k, slots);
+    StudentResultSet *result = make_slot_result(manager, slots, count);
+    free(slots);
+    return result;
+}
+
+// ĺ a b   1 (GPA  Ű ۰ų,   )
+static int top_entry_better(const SortEntry *a, const SortEntry *b) {
+    if (a->key != b->key) return a->key < b->key;
+    return a->slot < b->slot;
+}
+
+//   ĺ     pos ׸ Ʒ 
+static void top_heap_sift_down(SortEntry *heap, int count, int pos) {
+    for (;;) {
+        int worst = pos;
+        int left = pos * 2 + 1;
+        int right = left + 1;
+        if (left < count && top_entry_better(&heap[worst], &heap[left])) worst = left;
+        if (right < count && top_entry_better(&heap[worst], &heap[right])) worst = right;
+        if (worst == pos) return;
+        
+        SortEntry tmp = heap[pos];
+        heap[pos] = heap[worst];
+        heap[worst] = tmp;
+        pos = worst;
+    }
+}
+
+//   ĺ      ׸ ְ  ø
+static void top_heap_push(SortEntry *heap, int count, SortEntry entry) {
+    int pos = count;
+    while (pos > 0) {
+        int parent = (pos - 1) / 2;
+        if (!top_entry_better(&heap[parent], &entry)) break;
+        heap[pos] = heap[parent];
+        pos = parent;
+    }
+    heap[pos] = entry;
+}
+
+//   л  - limits[ ID],  ÷   ȸ
+//  ũⰡ ѵ  ĺ ϰ   ķ   
+static MajorTopResult* select_top_by_major(const StudentManager *manager, const int *limits) {
+    int group_count = manager->majors.count;
+    const HotColumns *hot = &manager->hot;
+    
+    MajorTopResult *result = (MajorTopResult*)malloc(sizeof(MajorTopResult));
+    int *offsets = (int*)malloc(sizeof(int) * (group_count + 1));
+    int *sizes = (int*)calloc(group_count > 0 ? group_count : 1, sizeof(int));
+    if (!result || !offsets || !sizes) {
+        fprintf(stderr, "޸ Ҵ :   л\n");
+        free(result);
+        free(offsets);
+        free(sizes);
+        return NULL;
+    }
+    
+    //   ϳ 迭 ̾ ġ
+    offsets[0] = 0;
+    for (int g = 0; g < group_count; g++) {
+        offsets[g + 1] = offsets[g] + limits[g];
+    }
+    
+    int total = offsets[group_count];
+    SortEntry *heaps = (SortEntry*)malloc(sizeof(SortEntry) * (total > 0 ? total : 1));
+    result->groups = (StudentResultSet*)calloc(group_count > 0 ? group_count : 1, sizeof(StudentResultSet));
+    result->group_count = group_count;
+    if (!heaps || !result->groups) {
+        fprintf(stderr, "޸ Ҵ :   л\n");
+        free(heaps);
+        free(result->groups);
+        free(result);
+        free(offsets);
+        free(sizes);
+        return NULL;
+    }
+    
+    for (int slot = 0; slot < manager->slot_count; slot++) {
+        if (!hot->live[slot]) continue;
+        
+        int g = hot->major_id[slot];
+        if (g < 0 || limits[g] == 0) continue;
+        
+        SortEntry entry;
+        entry.key = gpa_sort_key(hot->gpa[slot]);
+        entry.slot = slot;
+        
+        SortEntry *heap = heaps + offsets[g];
+        if (sizes[g] < limits[g]) {
+            top_heap_push(heap, sizes[g]++, entry);
+        } else if (top_entry_better(&entry, &heap[0])) {
+            heap[0] = entry;
+            top_heap_sift_down(heap, sizes[g], 0);
+        }
+    }
+    
+    //  :   ĺ ڿ ä  1
+    int ok = 1;
+    for (int g = 0; g < group_count; g++) {
+        SortEntry *heap = heaps + offsets[g];
+        StudentResultSet *group = &result->groups[g];
+        
+        group->count = sizes[g];
+        group->items = (StudentRecord**)malloc(sizeof(StudentRecord*) * (sizes[g] > 0 ? sizes[g] : 1));
+        if (!group->items) {
+            ok = 0;
+            continue;
         }
+        for (int n = sizes[g]; n > 0; n--) {
+            group->items[n - 1] = get_record(manager, heap[0].slot);
+            heap[0] = heap[n - 1];
+            top_heap_sift_down(heap, n - 1, 0);
+        }
+    }
+    
+    free(heaps);
+    free(offsets);
+    free(sizes);
+    
+    if (!ok) {
+        fprintf(stderr, "޸ Ҵ :   л\n");
+        free_major_top_result(result);
+        return NULL;
     }
-    return top;
+    return result;
 }
 
-// Ư  ü   
-float get_subject_average(const StudentManager *manager, const char *subject) {
-    float total_score = 0.0;
-    int count = 0;
+//   ÷ л   (counts   ũ) -  ǥÿ  ID   
+static void count_students_by_major(const StudentManager *manager, int *counts) {
+    for (int slot = 0; slot < manager->slot_count; slot++) {
+        if (manager->hot.live[slot] && manager->hot.major_id[slot] >= 0) {
+            counts[manager->hot.major_id[slot]]++;
+        }
+    }
+}
+
+//  GPA  n ( ID   ȯ) - free_major_top_result 
+MajorTopResult* get_top_students_by_major(const StudentManager *manager, int n) {
+    int group_count = manager->majors.count;
+    int *limits = (int*)calloc(group_count > 0 ? group_count : 1, sizeof(int));
+    if (!limits) {
+        fprintf(stderr, "޸ Ҵ :   л\n");
+        return NULL;
+    }
     
-    for (int i = 0; i < manager->count; i++) {
-        for (int j = 0; j < manager->records[i].subject_count; j++) {
-            if (strcmp(manager->records[i].grades[j].subject, subject) == 0) {
-                total_score += manager->records[i].grades[j].score;
-                count++;
-                break;
-            }
+    count_students_by_major(manager, limits);
+    for (int g = 0; g < group_count; g++) {
+        if (limits[g] > n) limits[g] = (n > 0) ? n : 0;
+    }
+    
+    MajorTopResult *result = select_top_by_major(manager, limits);
+    free(limits);
+    return result;
+}
+
+//  GPA  percent% ( ο  ø, л  ּ 1) - free_major_top_result 
+MajorTopResult* get_top_percent_by_major(const StudentManager *manager, double percent) {
+    int group_count = manager->majors.count;
+    int *limits = (int*)calloc(group_count > 0 ? group_count : 1, sizeof(int));
+    if (!limits) {
+        fprintf(stderr, "޸ Ҵ :   л\n");
+        return NULL;
+    }
+    
+    if (percent > 100.0) percent = 100.0;
+    count_students_by_major(manager, limits);
+    for (int g = 0; g < group_count; g++) {
+        double exact = limits[g] * (percent > 0.0 ? percent : 0.0) / 100.0;
+        limits[g] = (int)exact;
+        if (limits[g] < exact) limits[g]++;
+    }
+    
+    MajorTopResult *result = select_top_by_major(manager, limits);
+    free(limits);
+    return result;
+}
+
+//   л  
+void free_major_top_result(MajorTopResult *result) {
+    if (result) {
+        for (int g = 0; g < result->group_count; g++) {
+            free(result->groups[g].items);
         }
+        free(result->groups);
+        free(result);
+    }
+}
+
+//  ü 踦   ȸ -  迡 Ű Ƿ ڵ  
+// ְ/ л ĳð ȿȭ 쿡  ÷   
+void get_class_statistics(const StudentManager *manager, ClassStatistics *stats) {
+    const ClassAggregates *agg = get_class_aggregates(manager);
+    const float *gpa = manager->hot.gpa;
+    
+    stats->student_count = manager->count;
+    stats->graded_count = agg->graded_count;
+    stats->average_gpa = (agg->graded_count > 0) ? (float)(agg->gpa_sum / agg->graded_count) : 0.0;
+    stats->highest_gpa = (agg->top_slot != -1) ? gpa[agg->top_slot] : 0.0;
+    stats->lowest_gpa = (agg->low_slot != -1) ? gpa[agg->low_slot] : 0.0;
+    stats->top_student = get_top_student(manager);
+    for (int b = 0; b < GPA_BUCKET_COUNT; b++) {
+        stats->gpa_buckets[b] = agg->gpa_buckets[b];
     }
     
-    return (count > 0) ? (total_score / count) : 0.0;
+    //   GPA  ġ  ð ȸ
+    stats->gpa_p10 = sketch_quantile(&agg->gpa_sketch, 0.1);
+    stats->gpa_median = sketch_quantile(&agg->gpa_sketch, 0.5);
+    stats->gpa_p90 = sketch_quantile(&agg->gpa_sketch, 0.9);
 }
 
-// Ư  ϴ л  
-int count_students_with_subject(const StudentManager *manager, const char *subject) {
-    int count = 0;
+//   κ  (  ûũ ϳ)
+typedef struct {
+    int count;
+    double total;
+    float max_score;
+    float min_score;
+    int grade_counts[GRADE_LETTER_COUNT];
+} SubjectPartial;
+
+//    ĵ - ûũ κ   
+typedef struct {
+    const StudentManager *manager;
+    const PostingList *list;
+    SubjectPartial *partials;
+} SubjectScan;
+
+//   [begin, end) ׸ κ   ( л )
+static void subject_chunk(void *context, int chunk, int begin, int end) {
+    const SubjectScan *scan = (const SubjectScan*)context;
+    SubjectPartial *part = &scan->partials[chunk];
     
-    for (int i = 0; i < manager->count; i++) {
-        for (int j = 0; j < manager->records[i].subject_count; j++) {
-            if (strcmp(manager->records[i].grades[j].subject, subject) == 0) {
-                count++;
-                break;
-            }
+    memset(part, 0, sizeof(SubjectPartial));
+    part->min_score = 100.0;
+    for (int i = begin; i < end; i++) {
+        const SubjectPosting *posting = &scan->list->items[i];
+        if (!scan->manager->hot.live[posting->slot]) continue;
+        
+        part->count++;
+        part->total += posting->score;
+        if (posting->score > part->max_score) part->max_score = posting->score;
+        if (posting->score < part->min_score) part->min_score = posting->score;
+        
+        int letter = grade_letter_index(posting->grade);
+        if (letter != -1) part->grade_counts[letter]++;
+    }
+}
+
+//  踦    (   Ȯ)
+//   ûũ   Ǯ óϰ ûũ  ġǷ    
+void get_subject_statistics(const StudentManager *manager, const char *subject,
+                            SubjectStatistics *stats) {
+    SubjectPartial total;
+    SubjectPartial single;
+    memset(&total, 0, sizeof(total));
+    total.min_score = 100.0;
+    
+    //   ȣ 忡  籸 (۾  б⸸ )
+    const PostingList *list = get_subject_postings(manager, find_subject_id(subject));
+    int items = list ? list->count : 0;
+    int chunks = parallel_chunk_count(items, PARALLEL_CHUNK);
+    SubjectScan scan = { manager, list, NULL };
+    if (chunks > 1) {
+        scan.partials = (SubjectPartial*)malloc(sizeof(SubjectPartial) * chunks);
+    }
+    if (scan.partials) {
+        parallel_for_chunks(items, PARALLEL_CHUNK, subject_chunk, &scan);
+    }
+    
+    // ûũ  ħ (ûũ ϳ̰ų ޸ ̸  ûũ   ó)
+    for (int c = 0; c < chunks; c++) {
+        const SubjectPartial *part = &single;
+        if (scan.partials) {
+            part = &scan.partials[c];
+        } else {
+            SubjectScan serial = { manager, list, &single };
+            int begin = c * PARALLEL_CHUNK;
+            subject_chunk(&serial, 0, begin, (begin + PARALLEL_CHUNK < items) ? begin + PARALLEL_CHUNK : items);
+        }
+        
+        total.count += part->count;
+        total.total += part->total;
+        if (part->max_score > total.max_score) total.max_score = part->max_score;
+        if (part->min_score < total.min_score) total.min_score = part->min_score;
+        for (int k = 0; k < GRADE_LETTER_COUNT; k++) {
+            total.grade_counts[k] += part->grade_counts[k];
         }
     }
+    free(scan.partials);
     
-    return count;
+    stats->count = total.count;
+    stats->average_score = (total.count > 0) ? (float)(total.total / total.count) : 0.0;
+    stats->max_score = (total.count > 0) ? total.max_score : 0.0;
+    stats->min_score = (total.count > 0) ? total.min_score : 0.0;
+    for (int k = 0; k < GRADE_LETTER_COUNT; k++) {
+        stats->grade_counts[k] = total.grade_counts[k];
+    }
+    
+    //   ϰ Բ Ǵ   ġ ȸ
+    const QuantileSketch *sketch = list ? list->sketch : NULL;
+    stats->score_p10 = sketch ? sketch_quantile(sketch, 0.1) : 0.0;
+    stats->score_median = sketch ? sketch_quantile(sketch, 0.5) : 0.0;
+    stats->score_p90 = sketch ? sketch_quantile(sketch, 0.9) : 0.0;
+}
+
+// Ư  ü   
+float get_subject_average(const StudentManager *manager, const char *subject) {
+    SubjectStatistics stats;
+    get_subject_statistics(manager, subject, &stats);
+    return stats.average_score;
+}
+
+// Ư  ϴ л  
+int count_students_with_subject(const StudentManager *manager, const char *subject) {
+    SubjectStatistics stats;
+    get_subject_statistics(manager, subject, &stats);
+    return stats.count;
 }
 
 // Ư    (, ְ, ,  ο)
 void display_subject_statistics(const StudentManager *manager, const char *subject) {
-    int count = 0;
-    float total = 0.0;
-    float max_score = 0.0;
-    float min_score = 100.0;
-    int grade_count[5] = {0}; // A, B, C, D, F
+    SubjectStatistics stats;
     
     printf("\n==========  : %s ==========\n", subject);
     
     //  
-    for (int i = 0; i < manager->count; i++) {
-        for (int j = 0; j < manager->records[i].subject_count; j++) {
-            if (strcmp(manager->records[i].grades[j].subject, subject) == 0) {
-                float score = manager->records[i].grades[j].score;
-                char grade = manager->records[i].grades[j].grade;
-                
-                total += score;
-                count++;
-                
-                if (score > max_score) max_score = score;
-                if (score < min_score) min_score = score;
-                
-                // ޺ īƮ
-                switch (grade) {
-                    case 'A': grade_count[0]++; break;
-                    case 'B': grade_count[1]++; break;
-                    case 'C': grade_count[2]++; break;
-                    case 'D': grade_count[3]++; break;
-                    case 'F': grade_count[4]++; break;
-                }
-                break;
-            }
-        }
-    }
+    get_subject_statistics(manager, subject, &stats);
     
     //  
-    if (count == 0) {
+    if (stats.count == 0) {
         printf("ϴ л ϴ.\n");
     } else {
-        printf(" ο: %d\n", count);
-        printf(" : %.2f\n", total / count);
-        printf("ְ : %.1f\n", max_score);
-        printf(" : %.1f\n", min_score);
+        printf(" ο: %d\n", stats.count);
+        printf(" : %.2f\n", stats.average_score);
+        printf("ְ : %.1f\n", stats.max_score);
+        printf(" : %.1f\n", stats.min_score);
+        printf(" :  10%% %.1f / ߾Ӱ %.1f /  10%% %.1f\n",
+               stats.score_p10, stats.score_median, stats.score_p90);
         printf(" : A(%d) B(%d) C(%d) D(%d) F(%d)\n",
-               grade_count[0], grade_count[1], grade_count[2],
-               grade_count[3], grade_count[4]);
+               stats.grade_counts[0], stats.grade_counts[1], stats.grade_counts[2],
+               stats.grade_counts[3], stats.grade_counts[4]);
     }
     printf("==========================================\n");
 }
 
+// ׷  ؽ ̺ - ׷ ó   groups ̰ table ׷ ȣ Ŵ
+typedef struct {
+    GroupStats *groups;          // ׷ 迭 (ó  )
+    int count;                   // ׷ 
+    int capacity;                // groups 迭 ũ
+    int *table;                  //  ּҹ ؽ ̺ (׷ ȣ,  ĭ -1)
+    int table_size;              // table ũ (2 ŵ)
+    int failed;                  // ޸ Ҵ  
+} GroupTable;
+
+// ׷ Ű ؽ
+static unsigned int group_hash(int major_id, int year, int subject_id) {
+    unsigned int h = (unsigned int)major_id * 0x9E3779B1u;
+    h ^= (unsigned int)year * 0x85EBCA77u;
+    h ^= (unsigned int)subject_id * 0xC2B2AE3Du;
+    h ^= h >> 15;
+    h *= 0x2C1B3C6Du;
+    h ^= h >> 13;
+    return h;
+}
+
+// ׷ ̺ ޸ 
+static void free_group_table(GroupTable *table) {
+    free(table->groups);
+    free(table->table);
+    memset(table, 0, sizeof(GroupTable));
+}
+
+// ؽ ̺ size ĭ ٽ  -   1,   0 ȯ
+static int group_table_resize(GroupTable *table, int size) {
+    int *slots = (int*)malloc(sizeof(int) * size);
+    if (!slots) return 0;
+    
+    for (int i = 0; i < size; i++) slots[i] = -1;
+    for (int g = 0; g < table->count; g++) {
+        const GroupStats *group = &table->groups[g];
+        unsigned int pos = group_hash(group->major_id, group->year, group->subject_id) & (size - 1);
+        while (slots[pos] != -1) pos = (pos + 1) & (size - 1);
+        slots[pos] = g;
+    }
+    free(table->table);
+    table->table = slots;
+    table->table_size = size;
+    return 1;
+}
+
+// Ű شϴ ׷ ã (  ׷ ߰) - ޸   NULL
+static GroupStats* group_table_get(GroupTable *table, int major_id, int year, int subject_id) {
+    if (table->failed) return NULL;
+    
+    //  1/2 Ϸ 
+    if ((table->count + 1) * 2 > table->table_size &&
+        !group_table_resize(table, table->table_size ? table->table_size * 2 : 64)) {
+        table->failed = 1;
+        return NULL;
+    }
+    
+    unsigned int mask = (unsigned int)table->table_size - 1;
+    unsigned int pos = group_hash(major_id, year, subject_id) & mask;
+    while (table->table[pos] != -1) {
+        GroupStats *group = &table->groups[table->table[pos]];
+        if (group->major_id == major_id && group->year == year && group->subject_id == subject_id) {
+            return group;
+        }
+        pos = (pos + 1) & mask;
+    }
+    
+    if (table->count == table->capacity) {
+        int new_capacity = table->capacity ? table->capacity * 2 : 32;
+        GroupStats *groups = (GroupStats*)realloc(table->groups, sizeof(GroupStats) * new_capacity);
+        if (!groups) {
+            table->failed = 1;
+            return NULL;
+        }
+        table->groups = groups;
+        table->capacity = new_capacity;
+    }
+    
+    GroupStats *group = &table->groups[table->count];
+    memset(group, 0, sizeof(GroupStats));
+    group->major_id = major_id;
+    group->year = year;
+    group->subject_id = subject_id;
+    table->table[pos] = table->count++;
+    return group;
+}
+
+// ׷쿡 л   GPA ݿ (  л ο )
+static void group_add_student(GroupStats *group, float gpa, int graded) {
+    group->student_count++;
+    if (!graded) return;
+    
+    if (group->graded_count == 0 || gpa < group->min_gpa) group->min_gpa = gpa;
+    if (group->graded_count == 0 || gpa > group->max_gpa) group->max_gpa = gpa;
+    group->graded_count++;
+    group->gpa_sum += gpa;
+}
+
+// (YYYY-MM-DD)  -  ٸ 0
+static int registration_year(const char *reg_date) {
+    int year = 0;
+    for (int i = 0; i < 4; i++) {
+        if (reg_date[i] < '0' || reg_date[i] > '9') return 0;
+        year = year * 10 + (reg_date[i] - '0');
+    }
+    return year;
+}
+
+// ׷   ĵ - ûũ ׷ ̺  
+typedef struct {
+    const StudentManager *manager;
+    int keys;                    // GROUP_BY_* 
+    GroupTable *tables;          // ûũ ׷ ̺
+} GroupScan;
+
+// ûũ [begin, end)  л ׷캰 
+static void group_chunk(void *context, int chunk, int begin, int end) {
+    const GroupScan *scan = (const GroupScan*)context;
+    const HotColumns *hot = &scan->manager->hot;
+    GroupTable *table = &scan->tables[chunk];
+    
+    for (int slot = begin; slot < end && !table->failed; slot++) {
+        if (!hot->live[slot]) continue;
+        
+        const StudentRecord *record = get_record(scan->manager, slot);
+        int major_id = (scan->keys & GROUP_BY_MAJOR) ? hot->major_id[slot] : -1;
+        int year = (scan->keys & GROUP_BY_YEAR) ? registration_year(record->info.reg_date) : -1;
+        int graded = hot->subject_count[slot] > 0;
+        
+        if (!(scan->keys & GROUP_BY_SUBJECT)) {
+            // л  ׷ -   л  
+            GroupStats *group = group_table_get(table, major_id, year, -1);
+            if (!group) break;
+            group_add_student(group, hot->gpa[slot], graded);
+            for (int j = 0; j < record->subject_count; j++) {
+                int letter = grade_letter_index(record->grades[j].grade);
+                if (letter != -1) group->grade_counts[letter]++;
+            }
+            continue;
+        }
+        
+        //   ׷ - л  񸶴   ϰ     
+        for (int j = 0; j < record->subject_count; j++) {
+            const Grade *grade = &record->grades[j];
+            
+            //      ù   (  )
+            if (find_grade_index(record, grade->subject_id) != j) continue;
+            
+            GroupStats *group = group_table_get(table, major_id, year, grade->subject_id);
+            if (!group) break;
+            group_add_student(group, hot->gpa[slot], graded);
+            int letter = grade_letter_index(grade->grade);
+            if (letter != -1) group->grade_counts[letter]++;
+        }
+    }
+}
+
+// ûũ   ̺ ħ (ûũ  ȣ) -   1,   0 ȯ
+static int group_merge(GroupTable *dest, const GroupTable *src) {
+    for (int g = 0; g < src->count; g++) {
+        const GroupStats *part = &src->groups[g];
+        GroupStats *group = group_table_get(dest, part->major_id, part->year, part->subject_id);
+        if (!group) return 0;
+        
+        if (part->graded_count > 0) {
+            if (group->graded_count == 0 || part->min_gpa < group->min_gpa) group->min_gpa = part->min_gpa;
+            if (group->graded_count == 0 || part->max_gpa > group->max_gpa) group->max_gpa = part->max_gpa;
+        }
+        group->student_count += part->student_count;
+        group->graded_count += part->graded_count;
+        group->gpa_sum += part->gpa_sum;
+        for (int k = 0; k < GRADE_LETTER_COUNT; k++) {
+            group->grade_counts[k] += part->grade_counts[k];
+        }
+    }
+    return 1;
+}
+
+// ׷ Ű  Լ ( ID, ,  ID , qsort)
+static int compare_groups(const void *a, const void *b) {
+    const GroupStats *group_a = (const GroupStats *)a;
+    const GroupStats *group_b = (const GroupStats *)b;
+    
+    if (group_a->major_id != group_b->major_id) return (group_a->major_id > group_b->major_id) ? 1 : -1;
+    if (group_a->year != group_b->year) return (group_a->year > group_b->year) ? 1 : -1;
+    return (group_a->subject_id > group_b->subject_id) - (group_a->subject_id < group_b->subject_id);
+}
+
+// / / (GROUP_BY_* Ʈ OR)  - ڸ   
+//  ûũ ؽ 踦  Ǯ óϰ ûũ  ġǷ    
+// ׷ Ű ̸ free_group_result , ޸   NULL ȯ
+GroupResult* group_students(const StudentManager *manager, int keys) {
+    keys &= GROUP_BY_MAJOR | GROUP_BY_YEAR | GROUP_BY_SUBJECT;
+    
+    GroupResult *result = (GroupResult*)malloc(sizeof(GroupResult));
+    if (!result) {
+        fprintf(stderr, "޸ Ҵ : ׷ \n");
+        return NULL;
+    }
+    
+    int chunks = parallel_chunk_count(manager->slot_count, PARALLEL_CHUNK);
+    GroupTable total;
+    GroupTable single;
+    memset(&total, 0, sizeof(total));
+    memset(&single, 0, sizeof(single));
+    GroupScan scan = { manager, keys, NULL };
+    if (chunks > 1) {
+        scan.tables = (GroupTable*)calloc(chunks, sizeof(GroupTable));
+    }
+    if (scan.tables) {
+        parallel_for_chunks(manager->slot_count, PARALLEL_CHUNK, group_chunk, &scan);
+    }
+    
+    // ûũ  ħ (ûũ ϳ̰ų ޸ ̸  ûũ   ó)
+    int ok = 1;
+    for (int c = 0; c < chunks; c++) {
+        GroupTable *part = &single;
+        if (scan.tables) {
+            part = &scan.tables[c];
+        } else {
+            GroupScan serial = { manager, keys, &single };
+            int begin = c * PARALLEL_CHUNK;
+            single.count = 0;
+            for (int i = 0; i < single.table_size; i++) single.table[i] = -1;
+            group_chunk(&serial, 0, begin, (begin + PARALLEL_CHUNK < manager->slot_count) ? begin + PARALLEL_CHUNK : manager->slot_count);
+        }
+        
+        ok = ok && !part->failed && group_merge(&total, part);
+        if (scan.tables) free_group_table(part);
+    }
+    free(scan.tables);
+    free_group_table(&single);
+    
+    if (!ok || total.failed) {
+        fprintf(stderr, "޸ Ҵ : ׷ \n");
+        free_group_table(&total);
+        free(result);
+        return NULL;
+    }
+    
+    // Ű  ϰ   (ؽ ̺  ̻ ʿ )
+    if (total.count > 1) {
+        qsort(total.groups, total.count, sizeof(GroupStats), compare_groups);
+    }
+    for (int g = 0; g < total.count; g++) {
+        GroupStats *group = &total.groups[g];
+        group->average_gpa = (group->graded_count > 0) ? (float)(group->gpa_sum / group->graded_count) : 0.0;
+    }
+    
+    result->groups = total.groups;
+    result->count = total.count;
+    result->keys = keys;
+    free(total.table);
+    return result;
+}
+
+// ׷   
+void free_group_result(GroupResult *result) {
+    if (result) {
+        free(result->groups);
+        free(result);
+    }
+}
+
+// ׷캰   (keys GROUP_BY_* Ʈ OR)
+void display_group_statistics(const StudentManager *manager, int keys) {
+    GroupResult *result = group_students(manager, keys);
+    if (!result) return;
+    
+    printf("\n================ ׷캰  ================\n");
+    if (result->keys & GROUP_BY_MAJOR) printf("%-20s ", "");
+    if (result->keys & GROUP_BY_YEAR) printf("%-6s ", "");
+    if (result->keys & GROUP_BY_SUBJECT) printf("%-20s ", "");
+    printf("%6s %8s %6s %6s  %s\n", "ο", "GPA", "", "ְ", "  (A/B/C/D/F)");
+    printf("---------------------------------------------\n");
+    
+    for (int g = 0; g < result->count; g++) {
+        const GroupStats *group = &result->groups[g];
+        if (result->keys & GROUP_BY_MAJOR) printf("%-20s ", get_string(&manager->majors, group->major_id));
+        if (result->keys & GROUP_BY_YEAR) printf("%-6d ", group->year);
+        if (result->keys & GROUP_BY_SUBJECT) printf("%-20s ", get_subject_name(group->subject_id));
+        printf("%6d %8.2f %6.2f %6.2f  %d/%d/%d/%d/%d\n",
+               group->student_count, group->average_gpa, group->min_gpa, group->max_gpa,
+               group->grade_counts[0], group->grade_counts[1], group->grade_counts[2],
+               group->grade_counts[3], group->grade_counts[4]);
+    }
+    
+    if (result->count == 0) {
+        printf(" л ϴ.\n");
+    } else {
+        printf("---------------------------------------------\n");
+        printf(" %d ׷\n", result->count);
+    }
+    printf("=============================================\n");
+    
+    free_group_result(result);
+}
+
+//  ȣ  Լ (, qsort)
+static int compare_slots(const void *a, const void *b) {
+    int slot_a = *(const int *)a;
+    int slot_b = *(const int *)b;
+    return (slot_a > slot_b) - (slot_a < slot_b);
+}
+
+//   - ûũ ȭ   ξٰ ûũ  
+// direct    ٷ  ( ų  Ҵ翡  )
+typedef struct {
+    FILE *direct;                // ٷ  Ʈ (NULL̸ text )
+    char *text;                  // ȭ 
+    size_t length;               // text  Ʈ 
+    size_t capacity;             // text 迭 ũ
+    int rows;                    //  
+    int failed;                  //  Ҵ  
+} ReportChunk;
+
+// ˻   ۾ - slots[i]° л  ȭ
+typedef struct {
+    const StudentManager *manager;
+    const unsigned int *slots;   //   ( )
+    char grade;                  //  ˻  ã 
+    ReportChunk *chunks;         // ûũ  
+} ReportJob;
+
+//     ߰
+static void report_printf(ReportChunk *chunk, const char *format, ...) {
+    va_list args;
+    chunk->rows++;
+    if (chunk->failed) return;
+    
+    va_start(args, format);
+    if (chunk->direct) {
+        vfprintf(chunk->direct, format, args);
+        va_end(args);
+        return;
+    }
+    
+    va_list retry;
+    va_copy(retry, args);
+    size_t room = chunk->capacity - chunk->length;
+    int needed = vsnprintf(chunk->text ? chunk->text + chunk->length : NULL, room, format, args);
+    if (needed >= 0 && (size_t)needed >= room) {
+        // ۰ ڶ   ø  ٽ ȭ
+        size_t capacity = chunk->capacity ? chunk->capacity * 2 : 4096;
+        while (capacity < chunk->length + needed + 1) capacity *= 2;
+        char *text = (char*)realloc(chunk->text, capacity);
+        if (text) {
+            chunk->text = text;
+            chunk->capacity = capacity;
+            vsnprintf(text + chunk->length, capacity - chunk->length, format, retry);
+        } else {
+            chunk->failed = 1;
+        }
+    }
+    if (needed > 0 && !chunk->failed) chunk->length += needed;
+    va_end(retry);
+    va_end(args);
+}
+
+// ˻  count   -    ȯ
+//   ûũ ȭ  Ǯ  ϰ ûũ  ̾  ( °  )
+static int print_report(ReportJob *job, int count, ChunkTask format_rows) {
+    int chunks = parallel_chunk_count(count, PARALLEL_CHUNK);
+    ReportChunk direct = { stdout, NULL, 0, 0, 0, 0 };
+    
+    job->chunks = NULL;
+    if (count >= PARALLEL_MIN_ITEMS) {
+        job->chunks = (ReportChunk*)calloc(chunks, sizeof(ReportChunk));
+    }
+    if (!job->chunks) {
+        job->chunks = &direct;
+        format_rows(job, 0, 0, count);
+        return direct.rows;
+    }
+    
+    parallel_for_chunks(count, PARALLEL_CHUNK, format_rows, job);
+    
+    int rows = 0;
+    ReportChunk *results = job->chunks;
+    for (int c = 0; c < chunks; c++) {
+        if (results[c].failed) {
+            // ۸   ûũ ٷ ϸ ٽ ȭ
+            int begin = c * PARALLEL_CHUNK;
+            direct.rows = 0;
+            job->chunks = &direct;
+            format_rows(job, 0, begin, (begin + PARALLEL_CHUNK < count) ? begin + PARALLEL_CHUNK : count);
+            rows += direct.rows;
+        } else {
+            fwrite(results[c].text, 1, results[c].length, stdout);
+            rows += results[c].rows;
+        }
+        free(results[c].text);
+    }
+    free(results);
+    return rows;
+}
+
+// GPA  ˻   ȭ (л    )
+static void format_gpa_rows(void *context, int chunk, int begin, int end) {
+    const ReportJob *job = (const ReportJob*)context;
+    ReportChunk *out = &job->chunks[chunk];
+    
+    for (int i = begin; i < end; i++) {
+        const StudentRecord *record = get_record(job->manager, (int)job->slots[i]);
+        report_printf(out, "%-8d %-15s %-20s %.2f\n",
+                      record->info.id,
+                      record->info.name,
+                      record->info.major,
+                      record->gpa);
+    }
+}
+
+// GPA   ĵ - ûũ    ûũ ڸ 
+typedef struct {
+    const StudentManager *manager;
+    float min_gpa;
+    float max_gpa;
+    unsigned int *slots;         // slot_count ũ, ûũ c  c * PARALLEL_CHUNK
+    int *counts;                 // ûũ  
+} GpaRangeScan;
+
+// ûũ [begin, end)   GPA   л  ( ÷ )
+static void gpa_range_chunk(void *context, int chunk, int begin, int end) {
+    const GpaRangeScan *scan = (const GpaRangeScan*)context;
+    const HotColumns *hot = &scan->manager->hot;
+    unsigned int *out = scan->slots + begin;
+    int count = 0;
+    
+    for (int slot = begin; slot < end; slot++) {
+        if (hot->live[slot] && hot->gpa[slot] >= scan->min_gpa && hot->gpa[slot] <= scan->max_gpa) {
+            out[count++] = (unsigned int)slot;
+        }
+    }
+    scan->counts[chunk] = count;
+}
+
+// GPA [min_gpa, max_gpa] л  ()  ȯ (ȣڰ free) -   NULL
+//    Ʈ  ϰ,   ÷  ĵϿ ûũ  ̾ 
+static unsigned int* gpa_range_slots(const StudentManager *manager, float min_gpa, float max_gpa,
+                                     int *count) {
+    int first;
+    *count = get_gpa_range_ranks(manager, min_gpa, max_gpa, &first);
+    
+    if (*count < PARALLEL_MIN_ITEMS) {
+        unsigned int *slots = (unsigned int*)malloc(sizeof(unsigned int) * (*count > 0 ? *count : 1));
+        if (!slots) return NULL;
+        *count = get_students_by_rank(manager, first, first + *count, (int*)slots);
+        qsort(slots, *count, sizeof(unsigned int), compare_slots);
+        return slots;
+    }
+    
+    int chunks = parallel_chunk_count(manager->slot_count, PARALLEL_CHUNK);
+    GpaRangeScan scan = { manager, min_gpa, max_gpa, NULL, NULL };
+    scan.slots = (unsigned int*)malloc(sizeof(unsigned int) * manager->slot_count);
+    scan.counts = (int*)malloc(sizeof(int) * chunks);
+    if (!scan.slots || !scan.counts) {
+        free(scan.slots);
+        free(scan.counts);
+        return NULL;
+    }
+    
+    parallel_for_chunks(manager->slot_count, PARALLEL_CHUNK, gpa_range_chunk, &scan);
+    
+    // ûũ    ̾ 
+    *count = 0;
+    for (int c = 0; c < chunks; c++) {
+        memmove(scan.slots + *count, scan.slots + c * PARALLEL_CHUNK, sizeof(unsigned int) * scan.counts[c]);
+        *count += scan.counts[c];
+    }
+    free(scan.counts);
+    return scan.slots;
+}
+
+// GPA [min_gpa, max_gpa] л  (ڵ带  ʰ  Ʈ , O(log n))
+int count_students_by_gpa_range(const StudentManager *manager, float min_gpa, float max_gpa) {
+    int first;
+    return get_gpa_range_ranks(manager, min_gpa, max_gpa, &first);
+}
+
+// GPA [min_gpa, max_gpa] л  (GPA ) - free_result_set 
+StudentResultSet* find_students_by_gpa_range(const StudentManager *manager,
+                                             float min_gpa, float max_gpa) {
+    int first;
+    int count = get_gpa_range_ranks(manager, min_gpa, max_gpa, &first);
+    int *slots = (int*)malloc(sizeof(int) * (count > 0 ? count : 1));
+    if (!slots) {
+        fprintf(stderr, "޸ Ҵ : GPA  ˻\n");
+        return NULL;
+    }
+    
+    count = get_students_by_rank(manager, first, first + count, slots);
+    StudentResultSet *result = make_slot_result(manager, slots, count);
+    free(slots);
+    return result;
+}
+
 // GPA  л ˻ (min_gpa  GPA  max_gpa)
 void search_students_by_gpa_range(const StudentManager *manager, 
                                   float min_gpa, float max_gpa) {
@@ -229,16 +1180,15 @@ void search_students_by_gpa_range(const StudentManager *manager,
     printf("%-8s %-15s %-20s %s\n", "й", "̸", "", "GPA");
     printf("-----------------------------------------------\n");
     
-    for (int i = 0; i < manager->count; i++) {
-        if (manager->records[i].gpa >= min_gpa && 
-            manager->records[i].gpa <= max_gpa) {
-            printf("%-8d %-15s %-20s %.2f\n",
-                   manager->records[i].info.id,
-                   manager->records[i].info.name,
-                   manager->records[i].info.major,
-                   manager->records[i].gpa);
-            found++;
-        }
+    //   л     
+    int count;
+    unsigned int *slots = gpa_range_slots(manager, min_gpa, max_gpa, &count);
+    if (slots) {
+        ReportJob job = { manager, slots, 0, NULL };
+        found = print_report(&job, count, format_gpa_rows);
+        free(slots);
+    } else {
+        fprintf(stderr, "޸ Ҵ : GPA  ˻\n");
     }
     
     if (found == 0) {
@@ -250,6 +1200,42 @@ void search_students_by_gpa_range(const StudentManager *manager,
     printf("===============================================\n");
 }
 
+// Ʈ  ȣ  迭 ȯ (ȣڰ free) -   NULL, count 0
+static unsigned int* bitmap_slots(const RoaringBitmap *bitmap, int *count) {
+    *count = bitmap ? bitmap_cardinality(bitmap) : 0;
+    if (*count == 0) return NULL;
+    
+    unsigned int *slots = (unsigned int*)malloc(sizeof(unsigned int) * *count);
+    if (!slots) {
+        fprintf(stderr, "޸ Ҵ : Ʈ ȯ\n");
+        *count = 0;
+        return NULL;
+    }
+    bitmap_to_array(bitmap, slots);
+    return slots;
+}
+
+//  ˻   ȭ (л ش  񸶴  )
+static void format_grade_rows(void *context, int chunk, int begin, int end) {
+    const ReportJob *job = (const ReportJob*)context;
+    ReportChunk *out = &job->chunks[chunk];
+    
+    for (int i = begin; i < end; i++) {
+        const StudentRecord *record = get_record(job->manager, (int)job->slots[i]);
+        if (record->deleted) continue;
+        
+        for (int j = 0; j < record->subject_count; j++) {
+            if (record->grades[j].grade == job->grade) {
+                report_printf(out, "%-8d %-15s %-20s %.1f\n",
+                              record->info.id,
+                              record->info.name,
+                              get_subject_name(record->grades[j].subject_id),
+                              record->grades[j].score);
+            }
+        }
+    }
+}
+
 // Ư    ִ л ˻
 void search_students_by_grade(const StudentManager *manager, char grade) {
     int found = 0;
@@ -258,18 +1244,13 @@ void search_students_by_grade(const StudentManager *manager, char grade) {
     printf("%-8s %-15s %-20s %s\n", "й", "̸", "", "");
     printf("-----------------------------------------------\n");
     
-    for (int i = 0; i < manager->count; i++) {
-        for (int j = 0; j < manager->records[i].subject_count; j++) {
-            if (manager->records[i].grades[j].grade == grade) {
-                printf("%-8d %-15s %-20s %.1f\n",
-                       manager->records[i].info.id,
-                       manager->records[i].info.name,
-                       manager->records[i].grades[j].subject,
-                       manager->records[i].grades[j].score);
-                found++;
-            }
-        }
-    }
+    //  Ʈ ش  ִ л 湮 (  )
+    int count = 0;
+    unsigned int *slots = bitmap_slots(get_letter_bitmap(manager, -1, grade), &count);
+    
+    ReportJob job = { manager, slots, grade, NULL };
+    found = print_report(&job, count, format_grade_rows);
+    free(slots);
     
     if (found == 0) {
         printf("ش   л ϴ.\n");
@@ -277,6 +1258,94 @@ void search_students_by_grade(const StudentManager *manager, char grade) {
     printf("===============================================\n");
 }
 
+//  ˻ - , ,   Ʈ   (NULL/ ڿ/0  )
+//  ־   ޺ Ʈ  ϰ,   ü л ȯ
+//   ̸ free_result_set , ޸   NULL ȯ
+StudentResultSet* filter_students(StudentManager *manager, const char *subject,
+                                  char grade, const char *major) {
+    int has_subject = subject && subject[0] != '\0';
+    int has_major = major && major[0] != '\0';
+    int subject_id = has_subject ? find_subject_id(subject) : -1;
+    
+    RoaringBitmap subject_union;
+    RoaringBitmap combined;
+    init_bitmap(&subject_union);
+    init_bitmap(&combined);
+    
+    // Ǻ ĺ  (NULL̸   ϴ л )
+    const RoaringBitmap *conditions[2];
+    int condition_count = 0;
+    int ok = 1;
+    
+    if (has_subject && grade) {
+        // ϵ  ̸   ȸ(-1)  ʵ   ó
+        conditions[condition_count++] = subject_id >= 0 ? get_letter_bitmap(manager, subject_id, grade) : NULL;
+    } else if (has_subject) {
+        for (int k = 0; ok && subject_id >= 0 && k < GRADE_LETTER_COUNT; k++) {
+            const RoaringBitmap *pair = get_letter_bitmap(manager, subject_id, "ABCDF"[k]);
+            if (!pair) continue;
+            
+            RoaringBitmap merged;
+            init_bitmap(&merged);
+            ok = bitmap_or(&subject_union, pair, &merged);
+            destroy_bitmap(&subject_union);
+            subject_union = merged;
+        }
+        conditions[condition_count++] = &subject_union;
+    } else if (grade) {
+        conditions[condition_count++] = get_letter_bitmap(manager, -1, grade);
+    }
+    if (has_major) {
+        conditions[condition_count++] = get_major_bitmap(manager, find_string(&manager->majors, major));
+    }
+    
+    //  ̸  (̶    )
+    const RoaringBitmap *matched = condition_count > 0 ? conditions[0] : NULL;
+    if (ok && condition_count == 2) {
+        matched = NULL;
+        if (conditions[0] && conditions[1]) {
+            ok = bitmap_and(conditions[0], conditions[1], &combined);
+            matched = &combined;
+        }
+    }
+    
+    int count = 0;
+    unsigned int *slots = ok ? bitmap_slots(matched, &count) : NULL;
+    int capacity = condition_count > 0 ? count : manager->slot_count;
+    
+    StudentResultSet *result = ok ? (StudentResultSet*)malloc(sizeof(StudentResultSet)) : NULL;
+    if (result) {
+        result->count = 0;
+        result->items = (StudentRecord**)malloc(sizeof(StudentRecord*) * (capacity > 0 ? capacity : 1));
+        if (!result->items) {
+            free(result);
+            result = NULL;
+        }
+    }
+    
+    if (!result) {
+        fprintf(stderr, "޸ Ҵ :  ˻ \n");
+    } else if (condition_count > 0) {
+        //  ǥõ л Ʈ ǳʶ
+        for (int i = 0; i < count; i++) {
+            if (manager->hot.live[slots[i]]) {
+                result->items[result->count++] = get_record(manager, (int)slots[i]);
+            }
+        }
+    } else {
+        for (int i = 0; i < manager->slot_count; i++) {
+            if (manager->hot.live[i]) {
+                result->items[result->count++] = get_record(manager, i);
+            }
+        }
+    }
+    
+    free(slots);
+    destroy_bitmap(&subject_union);
+    destroy_bitmap(&combined);
+    return result;
+}
+
 //  Ʈ  ( N)
 void display_ranking_report(const StudentManager *manager) {
     if (manager->count == 0) {
@@ -284,7 +1353,7 @@ void display_ranking_report(const StudentManager *manager) {
         return;
     }
     
-    // GPA  (   纻   )
+    // GPA     (ڵ  ״ )
     calculate_rankings(manager);
 }
 
@@ -295,27 +1364,22 @@ void display_class_statistics(const StudentManager *manager) {
         return;
     }
     
-    printf("\n===============  ü  ===============\n");
-    printf(" л : %d\n", manager->count);
-    
-    //  ϵ л  
-    int students_with_grades = 0;
-    for (int i = 0; i < manager->count; i++) {
-        if (manager->records[i].subject_count > 0) {
-            students_with_grades++;
-        }
-    }
+    // /ְ//1/   ȸ ( )
+    ClassStatistics stats;
+    get_class_statistics(manager, &stats);
     
-    printf(" ϵ л : %d\n", students_with_grades);
+    printf("\n===============  ü  ===============\n");
+    printf(" л : %d\n", stats.student_count);
+    printf(" ϵ л : %d\n", stats.graded_count);
     
-    if (students_with_grades > 0) {
+    if (stats.graded_count > 0) {
         printf("\n----- GPA  -----\n");
-        printf(" GPA(0~4.5): %.2f / 4.5\n", get_class_average_gpa(manager));
-        printf("ְ GPA(0~4.5): %.2f / 4.5\n", get_highest_gpa(manager));
-        printf(" GPA(0~4.5): %.2f / 4.5\n", get_lowest_gpa(manager));
+        printf(" GPA(0~4.5): %.2f / 4.5\n", stats.average_gpa);
+        printf("ְ GPA(0~4.5): %.2f / 4.5\n", stats.highest_gpa);
+        printf(" GPA(0~4.5): %.2f / 4.5\n", stats.lowest_gpa);
         
         // 1 л 
-        StudentRecord *top = get_top_student(manager);
+        const StudentRecord *top = stats.top_student;
         if (top) {
             printf("\n----- 1 л -----\n");
             printf("й: %d\n", top->info.id);
@@ -325,17 +1389,7 @@ void display_class_statistics(const StudentManager *manager) {
         }
         
         // GPA  л  (0~4.5 )
-        int gpa_ranges[5] = {0}; // 4.0+, 3.5+, 3.0+, 2.5+, 2.5-
-        for (int i = 0; i < manager->count; i++) {
-            if (manager->records[i].subject_count > 0) {
-                float gpa = manager->records[i].gpa;
-                if (gpa >= 4.0) gpa_ranges[0]++;
-                else if (gpa >= 3.5) gpa_ranges[1]++;
-                else if (gpa >= 3.0) gpa_ranges[2]++;
-                else if (gpa >= 2.5) gpa_ranges[3]++;
-                else gpa_ranges[4]++;
-            }
-        }
+        const int *gpa_ranges = stats.gpa_buckets; // 4.0+, 3.5+, 3.0+, 2.5+, 2.5-
 
         printf("\n----- GPA  -----\n");
         printf("4.0 ̻: %d\n", gpa_ranges[0]);
@@ -343,6 +1397,8 @@ void display_class_statistics(const StudentManager *manager) {
         printf("3.0~3.49: %d\n", gpa_ranges[2]);
         printf("2.5~2.99: %d\n", gpa_ranges[3]);
         printf("2.5 ̸: %d\n", gpa_ranges[4]);
+        printf(" GPA:  10%% %.2f / ߾Ӱ %.2f /  10%% %.2f\n",
+               stats.gpa_p10, stats.gpa_median, stats.gpa_p90);
 
     }
     
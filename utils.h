@@ -6,25 +6,109 @@
 #include <stdlib.h>
 #include <string.h>
 
+// GPA Ҽ ȯ  (Ҽ ° ڸ, 0~4.5 -> 0~450)
+#define GPA_FIXED_SCALE 100
+
+//   ̸̻  並  ķ  (̸ qsort)
+#define RADIX_SORT_THRESHOLD 64
+
+//     Ʈ   д л 
+#define RANK_PAGE_SIZE 256
+
+//  ü  - get_class_statistics   ä (/ ȣڰ ó)
+typedef struct {
+    int student_count;           // ü л 
+    int graded_count;            //  ϵ л 
+    float average_gpa;           //  GPA ( ϵ л)
+    float highest_gpa;           // ְ GPA
+    float lowest_gpa;            //  GPA ( ϵ л ,  0)
+    const StudentRecord *top_student; // 1 л (л  NULL)
+    int gpa_buckets[GPA_BUCKET_COUNT]; // GPA  л  (4.0+, 3.5+, 3.0+, 2.5+, 2.5 ̸)
+    float gpa_p10;               // GPA  10%  (0.01 ,  ϵ л)
+    float gpa_median;            // GPA ߾Ӱ
+    float gpa_p90;               // GPA  10% 
+} ClassStatistics;
+
+//   - get_subject_statistics   ä
+typedef struct {
+    int count;                   //  ο ( л )
+    float average_score;         //   (  0)
+    float max_score;             // ְ  (  0)
+    float min_score;             //   (  0)
+    int grade_counts[GRADE_LETTER_COUNT]; // ޺ ο (A, B, C, D, F)
+    float score_p10;             //   10%  (0.1 )
+    float score_median;          //  ߾Ӱ
+    float score_p90;             //   10% 
+} SubjectStatistics;
+
+// ׷   (Ϸ Ʈ OR)
+#define GROUP_BY_MAJOR 0x1       // 
+#define GROUP_BY_YEAR 0x2        //   (reg_date  4ڸ)
+#define GROUP_BY_SUBJECT 0x4     //  
+
+// ׷ ϳ   (ؿ   Ű -1)
+//    л  񸶴   ׷쿡 ϰ      
+typedef struct {
+    int major_id;                //  ID (  )
+    int year;                    //   ( ٸ 0)
+    int subject_id;              //  ID
+    int student_count;           // ׷쿡  л 
+    int graded_count;            //   ϵ л  (GPA  )
+    double gpa_sum;              // GPA հ ( ϵ л)
+    float average_gpa;           //  GPA
+    float min_gpa;               //  GPA
+    float max_gpa;               // ְ GPA
+    int grade_counts[GRADE_LETTER_COUNT]; // ޺   (A, B, C, D, F)
+} GroupStats;
+
+// ׷   (Ű )
+typedef struct {
+    GroupStats *groups;          // ׷ 迭
+    int count;                   // ׷ 
+    int keys;                    //   (GROUP_BY_* )
+} GroupResult;
+
+//   л  ( ID )
+typedef struct {
+    StudentResultSet *groups;    // [ ID]   л (GPA )
+    int group_count;             //   (   ũ)
+} MajorTopResult;
+
 //  Լ
 void sort_by_id(StudentManager *manager);
 void sort_by_name(StudentManager *manager);
 void sort_by_gpa(StudentManager *manager);
+const int* get_sorted_view(StudentManager *manager, SortKey key, int *count);
+int gpa_to_fixed(float gpa);
 
 //   Լ
-void calculate_rankings(StudentManager *manager);
+void calculate_rankings(const StudentManager *manager);
 
 //  Լ
 float get_class_average_gpa(const StudentManager *manager);
 float get_highest_gpa(const StudentManager *manager);
 float get_lowest_gpa(const StudentManager *manager);
-StudentRecord* get_top_student(StudentManager *manager);
+StudentRecord* get_top_student(const StudentManager *manager);
+void get_class_statistics(const StudentManager *manager, ClassStatistics *stats);
+
+//  л ȸ Լ (GPA    ȯ)
+StudentResultSet* get_top_students(const StudentManager *manager, int k);
+MajorTopResult* get_top_students_by_major(const StudentManager *manager, int n);
+MajorTopResult* get_top_percent_by_major(const StudentManager *manager, double percent);
+void free_major_top_result(MajorTopResult *result);
 
 //   Լ
+void get_subject_statistics(const StudentManager *manager, const char *subject,
+                            SubjectStatistics *stats);
 float get_subject_average(const StudentManager *manager, const char *subject);
 int count_students_with_subject(const StudentManager *manager, const char *subject);
 void display_subject_statistics(const StudentManager *manager, const char *subject);
 
+// ׷캰  Լ
+GroupResult* group_students(const StudentManager *manager, int keys);
+void free_group_result(GroupResult *result);
+void display_group_statistics(const StudentManager *manager, int keys);
+
 //  Լ
 void display_ranking_report(const StudentManager *manager);
 void display_class_statistics(const StudentManager *manager);
@@ -32,7 +116,12 @@ void display_class_statistics(const StudentManager *manager);
 // ˻ Լ
 void search_students_by_gpa_range(const StudentManager *manager, 
                                   float min_gpa, float max_gpa);
+int count_students_by_gpa_range(const StudentManager *manager, float min_gpa, float max_gpa);
+StudentResultSet* find_students_by_gpa_range(const StudentManager *manager,
+                                             float min_gpa, float max_gpa);
 void search_students_by_grade(const StudentManager *manager, char grade);
+StudentResultSet* filter_students(StudentManager *manager, const char *subject,
+                                  char grade, const char *major);
 
 //  Լ (qsort)
 int compare_by_id(const void *a, const void *b);